@@ -1,19 +1,85 @@
 #include "LogParser.hpp"
 #include <algorithm>
 #include <sstream>
+#include <cstring>
+
+namespace
+{
+    inline bool isDigit(char c) noexcept
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    // 정규식 \s 와 같은 공백 문자
+    inline bool isSpace(char c) noexcept
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+    }
+
+    // "DDDD-DD-DD" (p 뒤로 10바이트가 있어야 함)
+    inline bool matchesDate(const char* p) noexcept
+    {
+        return isDigit(p[0]) && isDigit(p[1]) && isDigit(p[2]) && isDigit(p[3]) && p[4] == '-' &&
+               isDigit(p[5]) && isDigit(p[6]) && p[7] == '-' && isDigit(p[8]) && isDigit(p[9]);
+    }
+
+    // "DD:DD:DD" (p 뒤로 8바이트가 있어야 함)
+    inline bool matchesTime(const char* p) noexcept
+    {
+        return isDigit(p[0]) && isDigit(p[1]) && p[2] == ':' &&
+               isDigit(p[3]) && isDigit(p[4]) && p[5] == ':' && isDigit(p[6]) && isDigit(p[7]);
+    }
+
+    constexpr std::size_t DATE_LENGTH = 10;
+    constexpr std::size_t TIME_LENGTH = 8;
+}
 
 // 생성자
 LogParser::LogParser()
-    : totalParsed_(0)
-    , successfulParsed_(0)
 {
     initializePatterns();
 }
 
+// 복사 생성자 (atomic 은 복사할 수 없으므로 값을 읽어 옮김)
+LogParser::LogParser(const LogParser& other)
+    : logLevelPattern_(other.logLevelPattern_)
+{
+    copyStatistics(other);
+}
+
+// 복사 대입 연산자
+LogParser& LogParser::operator=(const LogParser& other)
+{
+    if (this != &other)
+    {
+        logLevelPattern_ = other.logLevelPattern_;
+        copyStatistics(other);
+    }
+    return *this;
+}
+
+// 이동 생성자
+LogParser::LogParser(LogParser&& other) noexcept
+    : logLevelPattern_(std::move(other.logLevelPattern_))
+{
+    copyStatistics(other);
+}
+
+// 이동 대입 연산자
+LogParser& LogParser::operator=(LogParser&& other) noexcept
+{
+    if (this != &other)
+    {
+        logLevelPattern_ = std::move(other.logLevelPattern_);
+        copyStatistics(other);
+    }
+    return *this;
+}
+
 // 한 라인 파싱
 std::optional<LogEntry> LogParser::parseLine(const std::string& line, std::size_t lineNumber) const
 {
-    totalParsed_++;
+    totalParsed_.value.fetch_add(1, std::memory_order_relaxed);
     
     // 빈 라인이나 너무 짧은 라인 건너뛰기
     if (line.empty() || line.length() < 10)
@@ -24,27 +90,30 @@ std::optional<LogEntry> LogParser::parseLine(const std::string& line, std::size_
     try
     {
         // 타임스탬프 추출
-        std::string timestamp = extractTimestamp(line);
-        if (timestamp.empty())
+        std::size_t timestampLength = 0;
+        std::size_t timestampStart = findTimestamp(line, timestampLength);
+        if (timestampStart == std::string::npos)
         {
             return std::nullopt;
         }
+        std::string timestamp = line.substr(timestampStart, timestampLength);
         
-        // 로그 레벨 추출
-        LogLevel level = extractLogLevel(line);
+        // 로그 레벨 추출 (메시지 시작 위치를 함께 받아 다시 검색하지 않음)
+        std::size_t levelEnd = 0;
+        LogLevel level = extractLogLevel(line, &levelEnd);
         if (level == LogLevel::UNKNOWN)
         {
             return std::nullopt;
         }
         
         // 메시지 추출 (타임스탬프와 레벨 이후의 텍스트)
-        std::string message = extractMessage(line, timestamp.length(), 0);
+        std::string message = extractMessage(line, timestampStart + timestampLength, levelEnd);
         if (message.empty())
         {
             return std::nullopt;
         }
         
-        successfulParsed_++;
+        successfulParsed_.value.fetch_add(1, std::memory_order_relaxed);
         return LogEntry(timestamp, level, message, lineNumber);
     }
     catch (const std::exception&)
@@ -125,41 +194,98 @@ std::vector<LogEntry> LogParser::filterByMinLevel(const std::vector<LogEntry>& e
 // 파싱 성공률
 double LogParser::getParseSuccessRate() const noexcept
 {
-    if (totalParsed_ == 0)
+    // 다른 스레드가 파싱 중이면 두 값이 서로 다른 시점의 값일 수 있으므로 성공 횟수가 시도 횟수를 넘지 않게 자름
+    std::size_t successful = successfulParsed_.value.load(std::memory_order_relaxed);
+    std::size_t total = totalParsed_.value.load(std::memory_order_relaxed);
+    if (total == 0)
     {
         return 0.0;
     }
     
-    return static_cast<double>(successfulParsed_) / static_cast<double>(totalParsed_);
+    return static_cast<double>(std::min(successful, total)) / static_cast<double>(total);
+}
+
+// private: 파싱 통계 복사 (복사/이동 연산자용)
+void LogParser::copyStatistics(const LogParser& other) noexcept
+{
+    totalParsed_.value.store(other.totalParsed_.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    successfulParsed_.value.store(other.successfulParsed_.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
 }
 
 // 통계 초기화
 void LogParser::resetStatistics() noexcept
 {
-    totalParsed_ = 0;
-    successfulParsed_ = 0;
+    totalParsed_.value.store(0, std::memory_order_relaxed);
+    successfulParsed_.value.store(0, std::memory_order_relaxed);
+}
+
+// private: 타임스탬프 위치 찾기
+std::size_t LogParser::findTimestamp(const std::string& line, std::size_t& length) noexcept
+{
+    constexpr std::size_t minLength = DATE_LENGTH + 1 + TIME_LENGTH;
+    if (line.size() < minLength)
+    {
+        return std::string::npos;
+    }
+    
+    // 후보 위치는 다섯 번째 글자가 '-' 인 곳뿐이므로 memchr 로 '-' 만 찾아 건너뜀
+    const char* data = line.data();
+    std::size_t last = line.size() - minLength;
+    std::size_t start = 0;
+    while (start <= last)
+    {
+        const void* dash = std::memchr(data + start + 4, '-', last - start + 1);
+        if (dash == nullptr)
+        {
+            break;
+        }
+        start = static_cast<std::size_t>(static_cast<const char*>(dash) - data) - 4;
+        
+        if (matchesDate(data + start) && isSpace(data[start + DATE_LENGTH]))
+        {
+            // 공백은 여러 개일 수 있음 (\s+)
+            std::size_t timeStart = start + DATE_LENGTH + 1;
+            while (timeStart < line.size() && isSpace(data[timeStart]))
+            {
+                ++timeStart;
+            }
+            if (timeStart + TIME_LENGTH <= line.size() && matchesTime(data + timeStart))
+            {
+                length = timeStart + TIME_LENGTH - start;
+                return start;
+            }
+        }
+        ++start;
+    }
+    
+    return std::string::npos;
 }
 
 // private: 타임스탬프 추출
 std::string LogParser::extractTimestamp(const std::string& line) const
 {
-    std::smatch match;
+    std::size_t length = 0;
+    std::size_t start = findTimestamp(line, length);
     
-    if (std::regex_search(line, match, timestampPattern_))
+    if (start != std::string::npos)
     {
-        return match[0].str();
+        return line.substr(start, length);
     }
     
     return "";
 }
 
 // private: 로그 레벨 추출
-LogLevel LogParser::extractLogLevel(const std::string& line) const
+LogLevel LogParser::extractLogLevel(const std::string& line, std::size_t* levelEnd) const
 {
     std::smatch match;
     
     if (std::regex_search(line, match, logLevelPattern_))
     {
+        if (levelEnd != nullptr)
+        {
+            *levelEnd = static_cast<std::size_t>(match.position(1) + match.length(1));
+        }
         std::string levelStr = match[1].str();
         return stringToLogLevel(levelStr);
     }
@@ -172,24 +298,14 @@ std::string LogParser::extractMessage(const std::string& line,
                                      std::size_t timestampEnd, 
                                      std::size_t levelEnd) const
 {
-    // 정규식을 사용하여 더 정확한 메시지 추출
-    std::smatch timestampMatch;
-    std::smatch levelMatch;
-    
-    // 타임스탬프 매치 위치 찾기
-    if (!std::regex_search(line, timestampMatch, timestampPattern_))
-    {
-        return "";
-    }
-    
-    // 로그 레벨 매치 위치 찾기
-    if (!std::regex_search(line, levelMatch, logLevelPattern_))
+    // 타임스탬프와 레벨은 parseLine 에서 이미 찾았으므로 위치만 받아서 사용
+    if (timestampEnd == 0 || levelEnd == 0)
     {
         return "";
     }
     
     // 레벨 이후의 위치부터 메시지 시작
-    std::size_t messageStart = levelMatch.position() + levelMatch.length();
+    std::size_t messageStart = levelEnd;
     
     // 메시지 부분 추출
     if (messageStart >= line.length())
@@ -218,8 +334,7 @@ std::string LogParser::extractMessage(const std::string& line,
 // private: 정규식 패턴 초기화
 void LogParser::initializePatterns()
 {
-    // 타임스탬프 패턴: YYYY-MM-DD HH:MM:SS 형식
-    timestampPattern_ = std::regex(R"(\d{4}-\d{2}-\d{2}\s+\d{2}:\d{2}:\d{2})");
+    // 타임스탬프는 findTimestamp 가 직접 검사
     
     // 로그 레벨 패턴: ERROR, WARN, INFO, DEBUG 등
     logLevelPattern_ = std::regex(R"(\b(ERROR|WARN|WARNING|INFO|DEBUG)\b)");
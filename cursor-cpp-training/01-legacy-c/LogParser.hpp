@@ -5,6 +5,7 @@
 #include <vector>
 #include <optional>
 #include <regex>
+#include <atomic>
 
 /**
  * @brief 로그 라인을 파싱하여 LogEntry 객체로 변환하는 클래스
@@ -24,11 +25,11 @@ public:
      */
     ~LogParser() = default;
     
-    // 복사 및 이동 연산자 허용
-    LogParser(const LogParser&) = default;
-    LogParser& operator=(const LogParser&) = default;
-    LogParser(LogParser&&) = default;
-    LogParser& operator=(LogParser&&) = default;
+    // 복사 및 이동 연산자 허용 (파싱 통계는 복사 시점의 값을 가져옴)
+    LogParser(const LogParser& other);
+    LogParser& operator=(const LogParser& other);
+    LogParser(LogParser&& other) noexcept;
+    LogParser& operator=(LogParser&& other) noexcept;
     
     /**
      * @brief 로그 라인을 파싱하여 LogEntry로 변환
@@ -74,6 +75,9 @@ public:
     
     /**
      * @brief 파싱 성공률 반환
+     *
+     * 여러 스레드가 같은 파서로 동시에 parseLine 을 호출해도 안전하며,
+     * 파싱 스레드들이 끝난 뒤(join 이후)에 읽으면 정확한 값입니다.
      * @return 파싱 성공률 (0.0 ~ 1.0)
      */
     double getParseSuccessRate() const noexcept;
@@ -84,12 +88,33 @@ public:
     void resetStatistics() noexcept;
 
 private:
-    mutable std::size_t totalParsed_;        ///< 총 파싱 시도 횟수
-    mutable std::size_t successfulParsed_;   ///< 성공한 파싱 횟수
+    /**
+     * @brief 캐시 라인 하나를 혼자 차지하는 카운터
+     *
+     * 두 카운터가 같은 캐시 라인에 있으면 여러 코어가 번갈아 쓰면서 라인을 뺏고 뺏기므로
+     * 각각 64바이트 경계에 맞춥니다. 순서 보장이 필요 없는 누적 값이라 relaxed 로 갱신합니다.
+     */
+    struct alignas(64) PaddedCounter
+    {
+        std::atomic<std::size_t> value{0};
+    };
+    
+    mutable PaddedCounter totalParsed_;        ///< 총 파싱 시도 횟수
+    mutable PaddedCounter successfulParsed_;   ///< 성공한 파싱 횟수
     
-    std::regex timestampPattern_;            ///< 타임스탬프 패턴
     std::regex logLevelPattern_;            ///< 로그 레벨 패턴
     
+    /**
+     * @brief "YYYY-MM-DD<공백 1개 이상>HH:MM:SS" 타임스탬프 위치 찾기
+     *
+     * 정규식 없이 자리마다 숫자와 구분자를 직접 검사하며,
+     * \d{4}-\d{2}-\d{2}\s+\d{2}:\d{2}:\d{2} 의 regex_search 와 같은 위치와 길이를 반환합니다.
+     * @param line 로그 라인
+     * @param length 찾은 타임스탬프 길이 (출력)
+     * @return 타임스탬프 시작 위치, 없으면 std::string::npos
+     */
+    static std::size_t findTimestamp(const std::string& line, std::size_t& length) noexcept;
+    
     /**
      * @brief 타임스탬프 추출
      * @param line 로그 라인
@@ -100,12 +125,13 @@ private:
     /**
      * @brief 로그 레벨 추출
      * @param line 로그 라인
+     * @param levelEnd 레벨 문자열 끝 위치 (출력, nullptr 이면 무시)
      * @return 추출된 로그 레벨
      */
-    LogLevel extractLogLevel(const std::string& line) const;
+    LogLevel extractLogLevel(const std::string& line, std::size_t* levelEnd = nullptr) const;
     
     /**
-     * @brief 로그 메시지 추출
+     * @brief 로그 메시지 추출 (레벨 이후의 텍스트, 앞뒤 공백 제거)
      * @param line 로그 라인
      * @param timestampEnd 타임스탬프 끝 위치
      * @param levelEnd 레벨 끝 위치
@@ -115,6 +141,12 @@ private:
                               std::size_t timestampEnd, 
                               std::size_t levelEnd) const;
     
+    /**
+     * @brief 다른 파서의 파싱 통계를 복사 (복사/이동 연산자용)
+     * @param other 통계를 가져올 파서
+     */
+    void copyStatistics(const LogParser& other) noexcept;
+    
     /**
      * @brief 정규식 패턴 초기화
      */
@@ -2,6 +2,8 @@
 #include <catch2/catch_approx.hpp>
 #include "LogParser.hpp"
 #include "LogEntry.hpp"
+#include <regex>
+#include <thread>
 
 TEST_CASE("LogParser 기본 파싱 테스트", "[LogParser]")
 {
@@ -84,6 +86,47 @@ TEST_CASE("LogParser 잘못된 입력 처리", "[LogParser][error]")
     }
 }
 
+TEST_CASE("LogParser 타임스탬프 스캐너", "[LogParser][timestamp]")
+{
+    LogParser parser;
+    
+    // 예전 구현이 쓰던 패턴을 기준으로 비교
+    const std::regex timestampPattern(R"(\d{4}-\d{2}-\d{2}\s+\d{2}:\d{2}:\d{2})");
+    std::vector<std::string> lines = {
+        "2023-12-01 10:30:15 ERROR Database connection failed",
+        "[app] 2023-12-01   10:30:15 INFO spaced",
+        "2023-12-01\t10:30:15 WARN tab",
+        "12023-12-01 10:30:15 DEBUG prefixed digits",
+        "2023-1-01 10:30:15 x 2024-01-02 03:04:05 ERROR second one",
+        "2023-12-01T10:30:15 INFO no separator",
+        "2023-12-01 10:30:1 ERROR truncated",
+        "----2023-12-01 10:30:15---- INFO dashes",
+        "2023-12-01 ERROR date only"
+    };
+    
+    for (const auto& line : lines)
+    {
+        std::smatch match;
+        bool expected = std::regex_search(line, match, timestampPattern);
+        auto entry = parser.parseLine(line);
+        
+        INFO(line);
+        REQUIRE(entry.has_value() == expected);
+        if (expected)
+        {
+            REQUIRE(entry->timestamp == match.str());
+        }
+    }
+    
+    SECTION("레벨 이후가 메시지")
+    {
+        auto entry = parser.parseLine("2023-12-01  10:30:15 ERROR   Disk full  ");
+        REQUIRE(entry.has_value());
+        REQUIRE(entry->timestamp == "2023-12-01  10:30:15");
+        REQUIRE(entry->message == "Disk full");
+    }
+}
+
 TEST_CASE("LogParser 여러 라인 파싱", "[LogParser][multiline]")
 {
     LogParser parser;
@@ -179,6 +222,44 @@ TEST_CASE("LogParser 통계 기능", "[LogParser][stats]")
         parser.resetStatistics();
         REQUIRE(parser.getParseSuccessRate() == 0.0);
     }
+    
+    SECTION("여러 스레드가 같은 파서를 공유")
+    {
+        // 스레드마다 성공 3 : 실패 1 비율로 파싱
+        constexpr int threadCount = 4;
+        constexpr int linesPerThread = 20000;
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threadCount; ++t)
+        {
+            workers.emplace_back([&parser]()
+            {
+                for (int i = 0; i < linesPerThread; ++i)
+                {
+                    parser.parseLine(i % 4 == 3 ? "invalid line" : "2023-12-01 09:00:00 INFO Test message");
+                }
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        
+        REQUIRE(parser.getParseSuccessRate() == 0.75);
+    }
+    
+    SECTION("복사한 파서는 통계를 가져가고 따로 누적")
+    {
+        parser.parseLine("2023-12-01 09:00:00 INFO Test message");
+        parser.parseLine("invalid line");
+        
+        LogParser copy = parser;
+        REQUIRE(copy.getParseSuccessRate() == 0.5);
+        
+        copy.parseLine("2023-12-01 09:00:01 ERROR Another message");
+        copy.parseLine("2023-12-01 09:00:02 WARN Third message");
+        REQUIRE(copy.getParseSuccessRate() == 0.75);
+        REQUIRE(parser.getParseSuccessRate() == 0.5);
+    }
 }
 
 TEST_CASE("LogEntry 유틸리티 함수 테스트", "[LogEntry]")
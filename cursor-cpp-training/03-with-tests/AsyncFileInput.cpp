@@ -0,0 +1,411 @@
+#include "AsyncFileInput.hpp"
+#include "CompressedInput.hpp"
+#include "PosixFile.hpp"
+#include <iostream>
+#include <vector>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <sys/stat.h>
+
+#ifdef LOG_ANALYZER_HAS_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+namespace LogAnalyzer {
+
+namespace {
+
+std::uintmax_t fileSizeOf(int fd) {
+    struct stat info {};
+    if (::fstat(fd, &info) != 0) {
+        return 0;
+    }
+    return static_cast<std::uintmax_t>(info.st_size);
+}
+
+// 읽기 스레드가 pread 로 블록을 미리 읽어 큐에 넣음
+void preadFileBlocks(const std::string& filePath, std::size_t blockSize, BlockQueue& queue) {
+    ScopedFd fd(filePath);
+    if (!fd.isOpen()) {
+        std::cerr << "파일 열기 실패: " << filePath << " (" << std::strerror(errno) << ")" << std::endl;
+        queue.fail();
+        return;
+    }
+
+    std::uintmax_t fileSize = fileSizeOf(fd.get());
+    std::uintmax_t offset = 0;
+    while (offset < fileSize) {
+        std::string block(static_cast<std::size_t>(std::min<std::uintmax_t>(blockSize, fileSize - offset)), '\0');
+        ssize_t n = preadFully(fd.get(), block.data(), block.size(), offset);
+        if (n < 0) {
+            std::cerr << "파일 읽기 실패: " << filePath << " (" << std::strerror(errno) << ")" << std::endl;
+            queue.fail();
+            return;
+        }
+        if (n == 0) {
+            return;
+        }
+        block.resize(static_cast<std::size_t>(n));
+        offset += static_cast<std::uintmax_t>(n);
+        if (!queue.push(std::move(block))) {
+            return;
+        }
+    }
+}
+
+#ifdef LOG_ANALYZER_HAS_URING
+
+// liburing 없이 시스템 콜로 직접 다루는 최소한의 io_uring 링
+// 제출/완료는 한 스레드에서만 하므로 커널과 공유하는 head/tail 만 acquire/release 로 접근
+class IoUringRing {
+public:
+    explicit IoUringRing(unsigned entries) {
+        io_uring_params params {};
+        ringFd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (ringFd_ < 0) {
+            return;
+        }
+
+        sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap) {
+            sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+        }
+
+        sqRing_ = mapRing(sqRingSize_, IORING_OFF_SQ_RING);
+        cqRing_ = singleMap ? sqRing_ : mapRing(cqRingSize_, IORING_OFF_CQ_RING);
+        sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = mapRing(sqesSize_, IORING_OFF_SQES);
+        if (sqRing_ == MAP_FAILED || cqRing_ == MAP_FAILED || sqes == MAP_FAILED) {
+            if (sqes != MAP_FAILED) {
+                ::munmap(sqes, sqesSize_);
+            }
+            release();
+            return;
+        }
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        char* sq = static_cast<char*>(sqRing_);
+        sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqMask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+        char* cq = static_cast<char*>(cqRing_);
+        cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqMask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+
+    ~IoUringRing() {
+        release();
+    }
+
+    IoUringRing(const IoUringRing&) = delete;
+    IoUringRing& operator=(const IoUringRing&) = delete;
+
+    bool isValid() const noexcept { return ringFd_ >= 0; }
+
+    // 읽기 버퍼를 커널에 고정 등록 (RLIMIT_MEMLOCK 등으로 실패하면 false)
+    bool registerBuffers(const std::vector<iovec>& buffers) {
+        return ::syscall(__NR_io_uring_register, ringFd_, IORING_REGISTER_BUFFERS,
+                         buffers.data(), static_cast<unsigned>(buffers.size())) == 0;
+    }
+
+    // buffer 로 읽기 제출, bufferIndex 가 0 이상이면 등록된 버퍼를 쓰는 READ_FIXED
+    // buffer 는 완료될 때까지 유지되어야 함
+    bool submitRead(int fd, const iovec* buffer, std::uintmax_t offset, std::uint64_t userData, int bufferIndex) {
+        unsigned tail = *sqTail_;
+        unsigned index = tail & sqMask_;
+        io_uring_sqe& sqe = sqes_[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.fd = fd;
+        sqe.off = offset;
+        sqe.user_data = userData;
+        if (bufferIndex >= 0) {
+            sqe.opcode = IORING_OP_READ_FIXED;
+            sqe.addr = reinterpret_cast<std::uint64_t>(buffer->iov_base);
+            sqe.len = static_cast<std::uint32_t>(buffer->iov_len);
+            sqe.buf_index = static_cast<std::uint16_t>(bufferIndex);
+        } else {
+            sqe.opcode = IORING_OP_READV;
+            sqe.addr = reinterpret_cast<std::uint64_t>(buffer);
+            sqe.len = 1;
+        }
+        sqArray_[index] = index;
+        __atomic_store_n(sqTail_, tail + 1, __ATOMIC_RELEASE);
+
+        return enter(1, 0, 0) >= 0;
+    }
+
+    // 완료 하나를 꺼냄 (없으면 대기)
+    bool waitCompletion(std::uint64_t& userData, int& result) {
+        unsigned head = *cqHead_;
+        while (head == __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE)) {
+            if (enter(0, 1, IORING_ENTER_GETEVENTS) < 0) {
+                return false;
+            }
+        }
+
+        const io_uring_cqe& cqe = cqes_[head & cqMask_];
+        userData = cqe.user_data;
+        result = cqe.res;
+        __atomic_store_n(cqHead_, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+private:
+    int ringFd_ = -1;
+    void* sqRing_ = MAP_FAILED;
+    void* cqRing_ = MAP_FAILED;
+    std::size_t sqRingSize_ = 0;
+    std::size_t cqRingSize_ = 0;
+    std::size_t sqesSize_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    unsigned* sqTail_ = nullptr;
+    unsigned sqMask_ = 0;
+    unsigned* sqArray_ = nullptr;
+    unsigned* cqHead_ = nullptr;
+    unsigned* cqTail_ = nullptr;
+    unsigned cqMask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+
+    void* mapRing(std::size_t size, off_t offset) {
+        return ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd_, offset);
+    }
+
+    int enter(unsigned toSubmit, unsigned minComplete, unsigned flags) {
+        int result;
+        do {
+            result = static_cast<int>(::syscall(__NR_io_uring_enter, ringFd_, toSubmit, minComplete, flags, nullptr, 0));
+        } while (result < 0 && errno == EINTR);
+        return result;
+    }
+
+    void release() {
+        if (sqes_ != nullptr) {
+            ::munmap(sqes_, sqesSize_);
+            sqes_ = nullptr;
+        }
+        if (cqRing_ != MAP_FAILED && cqRing_ != sqRing_) {
+            ::munmap(cqRing_, cqRingSize_);
+        }
+        if (sqRing_ != MAP_FAILED) {
+            ::munmap(sqRing_, sqRingSize_);
+        }
+        sqRing_ = cqRing_ = MAP_FAILED;
+        if (ringFd_ >= 0) {
+            ::close(ringFd_);
+            ringFd_ = -1;
+        }
+    }
+};
+
+// io_uring 으로 depth 개의 블록 읽기를 항상 앞서 걸어 두는 streambuf
+// 블록 i 는 슬롯 i % depth 에 읽히고, 소비가 끝난 슬롯은 바로 다음 블록 읽기에 재사용됨
+class IoUringStreamBuf : public InputStreamBuf {
+public:
+    IoUringStreamBuf(const std::string& filePath, std::size_t blockSize, std::size_t depth)
+        : file_(filePath), ring_(static_cast<unsigned>(depth)), blockSize_(blockSize),
+          storage_(blockSize * depth), slots_(depth) {
+        setg(nullptr, nullptr, nullptr);
+        if (!file_.isOpen() || !ring_.isValid()) {
+            return;
+        }
+        fileSize_ = fileSizeOf(file_.get());
+
+        std::vector<iovec> buffers(depth);
+        for (std::size_t i = 0; i < depth; ++i) {
+            slots_[i].buffer.iov_base = storage_.data() + i * blockSize_;
+            slots_[i].buffer.iov_len = blockSize_;
+            buffers[i] = slots_[i].buffer;
+        }
+        registered_ = ring_.registerBuffers(buffers);
+
+        for (std::size_t i = 0; i < depth; ++i) {
+            submit(i);
+        }
+        isValid_ = true;
+    }
+
+    ~IoUringStreamBuf() override {
+        // 커널이 아직 버퍼에 쓰고 있을 수 있으므로 걸려 있는 읽기를 모두 거둔 뒤 해제
+        while (pendingCount_ > 0 && reap()) {
+        }
+    }
+
+    IoUringStreamBuf(const IoUringStreamBuf&) = delete;
+    IoUringStreamBuf& operator=(const IoUringStreamBuf&) = delete;
+
+    bool isValid() const noexcept { return isValid_; }
+
+protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+        if (hasReadError()) {
+            // 실패한 블록 뒤의 데이터를 이어 붙이면 라인이 어긋나므로 더 내보내지 않음
+            return traits_type::eof();
+        }
+
+        if (consuming_) {
+            // 방금 다 읽은 슬롯으로 다음 블록 읽기를 걸고 다음 슬롯으로 이동
+            consuming_ = false;
+            submit(current_);
+            current_ = (current_ + 1) % slots_.size();
+        }
+
+        Slot& slot = slots_[current_];
+        while (slot.pending) {
+            if (!reap()) {
+                setReadError();
+                return traits_type::eof();
+            }
+        }
+        if (!slot.submitted) {
+            return traits_type::eof();
+        }
+        if (slot.result < 0) {
+            setReadError();
+            return traits_type::eof();
+        }
+
+        // 일반 파일에서는 드물지만 짧게 읽히면 나머지를 동기로 채움
+        char* data = static_cast<char*>(slot.buffer.iov_base);
+        std::size_t length = static_cast<std::size_t>(slot.result);
+        if (length < slot.expected) {
+            ssize_t n = preadFully(file_.get(), data + length, slot.expected - length, slot.offset + length);
+            if (n < 0) {
+                std::cerr << "파일 읽기 실패 (" << std::strerror(errno) << ")" << std::endl;
+                setReadError();
+                return traits_type::eof();
+            }
+            length += static_cast<std::size_t>(n);
+        }
+        if (length == 0) {
+            // 연 뒤에 파일이 줄어든 경우
+            return traits_type::eof();
+        }
+
+        slot.submitted = false;
+        consuming_ = true;
+        setg(data, data, data + length);
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    struct Slot {
+        iovec buffer {};
+        std::uintmax_t offset = 0;
+        std::size_t expected = 0;
+        int result = 0;
+        bool submitted = false;  // 이 슬롯에 아직 소비하지 않은 블록이 있음
+        bool pending = false;    // 커널이 읽는 중
+    };
+
+    ScopedFd file_;
+    IoUringRing ring_;
+    std::size_t blockSize_;
+    std::vector<char> storage_;
+    std::vector<Slot> slots_;
+    std::uintmax_t fileSize_ = 0;
+    std::uintmax_t nextOffset_ = 0;
+    std::size_t current_ = 0;
+    std::size_t pendingCount_ = 0;
+    bool registered_ = false;
+    bool consuming_ = false;
+    bool isValid_ = false;
+
+    void submit(std::size_t index) {
+        if (nextOffset_ >= fileSize_) {
+            return;
+        }
+
+        Slot& slot = slots_[index];
+        slot.offset = nextOffset_;
+        slot.expected = static_cast<std::size_t>(std::min<std::uintmax_t>(blockSize_, fileSize_ - nextOffset_));
+        slot.buffer.iov_len = slot.expected;
+        if (!ring_.submitRead(file_.get(), &slot.buffer, slot.offset, index, registered_ ? static_cast<int>(index) : -1)) {
+            int error = errno;
+            std::cerr << "io_uring 제출 실패 (" << std::strerror(error) << ")" << std::endl;
+            // 앞 블록들을 다 내보낸 뒤 이 블록 차례에 읽기 오류로 드러나도록 실패한 완료처럼 남김
+            nextOffset_ = fileSize_;
+            slot.result = -error;
+            slot.submitted = true;
+            return;
+        }
+
+        nextOffset_ += slot.expected;
+        slot.submitted = true;
+        slot.pending = true;
+        ++pendingCount_;
+    }
+
+    bool reap() {
+        std::uint64_t userData = 0;
+        int result = 0;
+        if (!ring_.waitCompletion(userData, result)) {
+            std::cerr << "io_uring 완료 대기 실패 (" << std::strerror(errno) << ")" << std::endl;
+            return false;
+        }
+
+        Slot& slot = slots_[static_cast<std::size_t>(userData)];
+        slot.pending = false;
+        slot.result = result;
+        --pendingCount_;
+        if (result < 0) {
+            std::cerr << "io_uring 읽기 실패 (" << std::strerror(-result) << ")" << std::endl;
+        }
+        return true;
+    }
+};
+
+#endif // LOG_ANALYZER_HAS_URING
+
+} // namespace
+
+bool isIoUringAvailable() {
+#ifdef LOG_ANALYZER_HAS_URING
+    static const bool available = IoUringRing(1).isValid();
+    return available;
+#else
+    return false;
+#endif
+}
+
+std::unique_ptr<InputStreamBuf> createAsyncReadStreamBuf(const std::string& filePath,
+                                                        AsyncReadBackend backend,
+                                                        std::size_t blockSize,
+                                                        std::size_t depth) {
+    blockSize = std::max<std::size_t>(blockSize, 1);
+    depth = std::max<std::size_t>(depth, 1);
+
+    if (::access(filePath.c_str(), R_OK) != 0) {
+        std::cerr << "파일 열기 실패: " << filePath << " (" << std::strerror(errno) << ")" << std::endl;
+        return nullptr;
+    }
+
+#ifdef LOG_ANALYZER_HAS_URING
+    if (backend == AsyncReadBackend::IoUring) {
+        auto buffer = std::make_unique<IoUringStreamBuf>(filePath, blockSize, depth);
+        if (buffer->isValid()) {
+            return buffer;
+        }
+        // 커널이 io_uring 을 막았거나 지원하지 않으면 읽기 스레드로 대체
+    }
+#else
+    (void)backend;
+#endif
+
+    return std::make_unique<DecodingStreamBuf>([filePath, blockSize](BlockQueue& queue) {
+        preadFileBlocks(filePath, blockSize, queue);
+    }, depth);
+}
+
+} // namespace LogAnalyzer
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CompressedInput.hpp"
+#include <string>
+#include <memory>
+#include <streambuf>
+
+namespace LogAnalyzer {
+
+// 비동기 읽기 블록 크기와 동시에 진행하는 읽기 수 기본값
+constexpr std::size_t ASYNC_READ_BLOCK_SIZE = 1 << 20;
+constexpr std::size_t ASYNC_READ_DEPTH = 4;
+
+// 미리 읽기 구현 방식
+enum class AsyncReadBackend {
+    IoUring,    // 등록된 버퍼로 고정 크기 읽기를 여러 개 제출
+    PreadThread // 읽기 스레드가 pread 로 앞서 읽어 큐에 넣음 (io_uring 을 쓸 수 없을 때)
+};
+
+// 현재 빌드와 커널에서 io_uring 을 쓸 수 있는지 (처음 호출 시 한 번만 확인)
+bool isIoUringAvailable();
+
+// 파일을 blockSize 단위로 depth 개까지 미리 읽어 두는 streambuf (열기 실패 시 nullptr)
+// std::istream 에 연결하면 파서가 앞 블록을 처리하는 동안 다음 블록들의 읽기가 진행됨
+// 열 때의 파일 크기까지만 읽음
+std::unique_ptr<InputStreamBuf> createAsyncReadStreamBuf(const std::string& filePath,
+                                                        AsyncReadBackend backend,
+                                                        std::size_t blockSize = ASYNC_READ_BLOCK_SIZE,
+                                                        std::size_t depth = ASYNC_READ_DEPTH);
+
+} // namespace LogAnalyzer
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <condition_variable>
+
+namespace LogAnalyzer {
+
+// 생산자 스레드와 소비자 사이의 크기 제한 큐
+// 생산자가 소비자보다 capacity 개 이상 앞서지 못하므로 메모리 사용량이 일정하게 유지됨
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(std::size_t capacity)
+        : capacity_(capacity == 0 ? 1 : capacity), finished_(false), failed_(false), cancelled_(false) {}
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    // 생산자: 항목 추가 (큐가 가득 차면 대기, 소비자가 취소했으면 false)
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notFull_.wait(lock, [this]() { return cancelled_ || items_.size() < capacity_; });
+        if (cancelled_) {
+            return false;
+        }
+        items_.push_back(std::move(item));
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    // 생산자: 더 이상 항목이 없음을 알림
+    void finish() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ = true;
+        notEmpty_.notify_all();
+    }
+
+    // 생산자: 실패로 생산을 끝냄 (이미 넣은 항목은 그대로 소비되고 이후 pop 은 std::nullopt)
+    void fail() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        failed_ = true;
+        finished_ = true;
+        notEmpty_.notify_all();
+    }
+
+    // 소비자: 다음 항목 (생산이 끝나고 큐가 비면 std::nullopt)
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notEmpty_.wait(lock, [this]() { return cancelled_ || finished_ || !items_.empty(); });
+        if (items_.empty()) {
+            return std::nullopt;
+        }
+        T item = std::move(items_.front());
+        items_.pop_front();
+        notFull_.notify_one();
+        return item;
+    }
+
+    // 소비자: 생산 중단 요청 (대기 중인 생산자를 깨움)
+    void cancel() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = true;
+        items_.clear();
+        notFull_.notify_all();
+        notEmpty_.notify_all();
+    }
+
+    bool isCancelled() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return cancelled_;
+    }
+
+    // 생산자가 fail() 로 끝냈는지 (pop 이 std::nullopt 를 준 뒤 EOF 와 구분할 때 사용)
+    bool hasFailed() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return failed_;
+    }
+
+private:
+    std::size_t capacity_;
+    std::deque<T> items_;
+    bool finished_;
+    bool failed_;
+    bool cancelled_;
+    mutable std::mutex mutex_;
+    std::condition_variable notEmpty_;
+    std::condition_variable notFull_;
+};
+
+} // namespace LogAnalyzer
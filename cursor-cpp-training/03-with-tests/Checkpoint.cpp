@@ -0,0 +1,289 @@
+#include "Checkpoint.hpp"
+#include "LogFileReader.hpp"
+#include "PosixFile.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cstdio>
+#include <sys/stat.h>
+#include <glob.h>
+
+namespace LogAnalyzer {
+
+namespace {
+
+// 상태 파일 첫 줄 (형식이 바뀌면 버전을 올림)
+constexpr const char* STATE_HEADER = "# log_analyzer checkpoint v2";
+
+// 지문 열이 없는 이전 형식 (읽기만 지원, 지문은 다음 저장 때 채워짐)
+constexpr const char* STATE_HEADER_V1 = "# log_analyzer checkpoint v1";
+
+// 체크포인트 지문으로 해시하는 오프셋 직전 바이트 수
+constexpr std::size_t FINGERPRINT_SIZE = 1024;
+
+// 레벨별 카운터를 기록하는 순서
+constexpr LogLevel STATE_LEVELS[] = {
+    LogLevel::UNKNOWN, LogLevel::ERROR, LogLevel::WARNING, LogLevel::INFO, LogLevel::DEBUG
+};
+
+// [offset - FINGERPRINT_SIZE, offset) 의 해시 (offset 이 0 이거나 읽을 수 없으면 0)
+std::uint64_t fingerprintAt(const std::string& filePath, std::uintmax_t offset) {
+    if (offset == 0) {
+        return 0;
+    }
+
+    ScopedFd fd(filePath);
+    if (!fd.isOpen()) {
+        return 0;
+    }
+
+    std::size_t length = static_cast<std::size_t>(std::min<std::uintmax_t>(offset, FINGERPRINT_SIZE));
+    std::string bytes(length, '\0');
+    if (preadFully(fd.get(), bytes.data(), length, offset - length) != static_cast<ssize_t>(length)) {
+        return 0;
+    }
+    return fnv1aHash(bytes.data(), length);
+}
+
+// 체크포인트가 가리키던 내용의 로테이션된 사본 (<경로>.1 또는 dateext 형식 <경로>-*)
+// rename 로테이션은 같은 inode 로, copytruncate 는 오프셋 직전 지문으로 알아봄
+std::optional<std::string> findRotatedFile(const std::string& filePath, const FileCheckpoint& checkpoint,
+                                           const struct stat& current) {
+    std::vector<std::string> candidates{filePath + ".1"};
+    glob_t matches{};
+    if (::glob((filePath + "-*").c_str(), 0, nullptr, &matches) == 0) {
+        candidates.insert(candidates.end(), matches.gl_pathv, matches.gl_pathv + matches.gl_pathc);
+    }
+    ::globfree(&matches);
+
+    for (const auto& candidate : candidates) {
+        struct stat info {};
+        if (::stat(candidate.c_str(), &info) != 0 || !S_ISREG(info.st_mode) ||
+            (info.st_dev == current.st_dev && info.st_ino == current.st_ino)) {
+            continue;
+        }
+
+        bool sameInode = checkpoint.device == static_cast<std::uintmax_t>(info.st_dev) &&
+                         checkpoint.inode == static_cast<std::uintmax_t>(info.st_ino);
+        bool sameContent = checkpoint.fingerprint != 0 &&
+                           static_cast<std::uintmax_t>(info.st_size) >= checkpoint.offset &&
+                           fingerprintAt(candidate, checkpoint.offset) == checkpoint.fingerprint;
+        if (sameInode || sameContent) {
+            return candidate;
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+void FileCheckpoint::addTo(Statistics& stats) const {
+    stats.totalLines += totalLines;
+    for (const auto& [level, count] : levelCounts) {
+        stats.levelCounts[level] += count;
+    }
+}
+
+CheckpointStore::CheckpointStore(const std::string& statePath) : statePath_(statePath) {}
+
+bool CheckpointStore::load() {
+    checkpoints_.clear();
+
+    std::ifstream input(statePath_);
+    if (!input) {
+        return true; // 첫 실행
+    }
+
+    std::string line;
+    if (!std::getline(input, line) || (line != STATE_HEADER && line != STATE_HEADER_V1)) {
+        std::cerr << "체크포인트 파일 형식이 올바르지 않습니다: " << statePath_ << std::endl;
+        return false;
+    }
+    bool hasFingerprint = line == STATE_HEADER;
+
+    // <device> <inode> <offset> <fingerprint> <totalLines> <레벨별 개수 x5> <경로> (v1 은 fingerprint 없음)
+    while (std::getline(input, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        FileCheckpoint checkpoint;
+        fields >> checkpoint.device >> checkpoint.inode >> checkpoint.offset;
+        if (hasFingerprint) {
+            fields >> checkpoint.fingerprint;
+        }
+        fields >> checkpoint.totalLines;
+        for (LogLevel level : STATE_LEVELS) {
+            std::size_t count = 0;
+            fields >> count;
+            if (count > 0) {
+                checkpoint.levelCounts[level] = count;
+            }
+        }
+        fields.get(); // 경로 앞 구분 공백
+        std::getline(fields, checkpoint.filePath);
+
+        if (fields.fail() || checkpoint.filePath.empty()) {
+            std::cerr << "체크포인트 항목을 읽을 수 없습니다: " << line << std::endl;
+            checkpoints_.clear();
+            return false;
+        }
+        checkpoints_.push_back(std::move(checkpoint));
+    }
+
+    return true;
+}
+
+bool CheckpointStore::save() const {
+    std::string tempPath = statePath_ + ".tmp";
+    {
+        std::ofstream output(tempPath, std::ios::trunc);
+        output << STATE_HEADER << "\n";
+        for (const auto& checkpoint : checkpoints_) {
+            output << checkpoint.device << ' ' << checkpoint.inode << ' ' << checkpoint.offset << ' '
+                   << checkpoint.fingerprint << ' ' << checkpoint.totalLines;
+            for (LogLevel level : STATE_LEVELS) {
+                auto it = checkpoint.levelCounts.find(level);
+                output << ' ' << (it != checkpoint.levelCounts.end() ? it->second : 0);
+            }
+            output << ' ' << checkpoint.filePath << "\n";
+        }
+        if (!output) {
+            std::cerr << "체크포인트 저장 실패: " << statePath_ << std::endl;
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(tempPath.c_str(), statePath_.c_str()) != 0) {
+        std::cerr << "체크포인트 저장 실패: " << statePath_ << std::endl;
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::optional<FileCheckpoint> CheckpointStore::find(const std::string& filePath) const {
+    auto it = std::find_if(checkpoints_.begin(), checkpoints_.end(),
+                           [&filePath](const FileCheckpoint& checkpoint) { return checkpoint.filePath == filePath; });
+    if (it == checkpoints_.end()) {
+        return std::nullopt;
+    }
+    return *it;
+}
+
+void CheckpointStore::update(const FileCheckpoint& checkpoint) {
+    auto it = std::find_if(checkpoints_.begin(), checkpoints_.end(),
+                           [&checkpoint](const FileCheckpoint& existing) { return existing.filePath == checkpoint.filePath; });
+    if (it == checkpoints_.end()) {
+        checkpoints_.push_back(checkpoint);
+    } else {
+        *it = checkpoint;
+    }
+}
+
+const std::vector<FileCheckpoint>& CheckpointStore::getCheckpoints() const noexcept {
+    return checkpoints_;
+}
+
+const std::string& CheckpointStore::getStatePath() const noexcept {
+    return statePath_;
+}
+
+ResumeResult resumeFromCheckpoint(const std::string& filePath, FileCheckpoint& checkpoint,
+                                  const LogParser& parser,
+                                  const std::function<void(const LogEntry& entry)>& onEntry) {
+    ResumeResult result;
+
+    struct stat info {};
+    if (::stat(filePath.c_str(), &info) != 0) {
+        std::cerr << "파일 정보를 읽을 수 없습니다: " << filePath << std::endl;
+        return result;
+    }
+    std::uintmax_t fileSize = static_cast<std::uintmax_t>(info.st_size);
+
+    LogFileReader reader(filePath);
+    if (!reader.isValid()) {
+        return result;
+    }
+
+    auto consume = [&](std::string_view view, std::string& line) {
+        line.assign(view.data(), view.size());
+        LogEntry entry = parser.parseLine(line);
+        checkpoint.totalLines++;
+        checkpoint.levelCounts[entry.level]++;
+        result.newLines++;
+        onEntry(entry);
+    };
+    std::string line;
+
+    // 다른 파일로 바뀌었거나 (rename 로테이션) 잘렸으면 (copytruncate) 처음부터
+    // 잘린 뒤 다시 커져 오프셋을 넘었어도 오프셋 직전 내용이 달라졌으면 잘린 것으로 봄
+    bool sameFile = checkpoint.device == static_cast<std::uintmax_t>(info.st_dev) &&
+                    checkpoint.inode == static_cast<std::uintmax_t>(info.st_ino);
+    bool seen = checkpoint.device != 0 || checkpoint.inode != 0;
+    bool rewritten = sameFile && !reader.isCompressed() &&
+                     (fileSize < checkpoint.offset ||
+                      (checkpoint.fingerprint != 0 && fingerprintAt(filePath, checkpoint.offset) != checkpoint.fingerprint));
+
+    if (seen && (!sameFile || rewritten)) {
+        // 새 파일로 넘어가기 전에 이전 파일에서 체크포인트 이후 남은 라인을 마저 처리
+        // 압축된 이전 파일은 이미 통째로 처리했으므로 읽을 것이 없음
+        if (auto rotated = findRotatedFile(filePath, checkpoint, info)) {
+            LogFileReader rotatedReader(*rotated);
+            if (rotatedReader.isValid() && !rotatedReader.isCompressed() && rotatedReader.seekTo(checkpoint.offset)) {
+                std::size_t before = result.newLines;
+                while (auto view = rotatedReader.readNextLineView()) {
+                    consume(*view, line); // 더 이상 쓰이지 않으므로 개행 없는 마지막 라인도 처리
+                }
+                result.rotatedLines = result.newLines - before;
+            }
+            result.rotatedPath = *rotated;
+        } else {
+            result.rotatedMissing = true;
+            std::cerr << "로테이션된 이전 파일을 찾지 못했습니다: " << filePath << " (오프셋 " << checkpoint.offset
+                      << " 이후 기록이 누락되었을 수 있음)" << std::endl;
+        }
+    }
+
+    if (!sameFile || rewritten) {
+        result.restarted = seen;
+        checkpoint.offset = 0;
+    }
+    checkpoint.filePath = filePath;
+    checkpoint.device = static_cast<std::uintmax_t>(info.st_dev);
+    checkpoint.inode = static_cast<std::uintmax_t>(info.st_ino);
+    result.startOffset = checkpoint.offset;
+
+    if (reader.isCompressed()) {
+        checkpoint.fingerprint = 0;
+        if (sameFile && seen) {
+            return result;
+        }
+        while (auto view = reader.readNextLineView()) {
+            consume(*view, line);
+        }
+        checkpoint.offset = fileSize;
+        return result;
+    }
+
+    if (!reader.seekTo(checkpoint.offset)) {
+        std::cerr << "체크포인트 위치로 이동할 수 없습니다: " << filePath << std::endl;
+        return result;
+    }
+
+    while (auto view = reader.readNextLineView()) {
+        if (!reader.isLastLineTerminated()) {
+            break; // 아직 쓰는 중인 라인은 다음 실행에서
+        }
+        consume(*view, line);
+        checkpoint.offset = reader.getReadOffset();
+    }
+    checkpoint.fingerprint = fingerprintAt(filePath, checkpoint.offset);
+
+    return result;
+}
+
+} // namespace LogAnalyzer
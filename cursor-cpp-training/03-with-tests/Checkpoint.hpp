@@ -0,0 +1,69 @@
+#pragma once
+
+#include "LogParser.hpp"
+#include "LogStats.hpp"
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <functional>
+
+namespace LogAnalyzer {
+
+// 파일 하나의 증분 분석 상태
+struct FileCheckpoint {
+    std::string filePath;
+    std::uintmax_t device = 0;
+    std::uintmax_t inode = 0;
+    std::uintmax_t offset = 0;      // 처리를 마친 마지막 완전한 라인의 끝
+    std::uint64_t fingerprint = 0;  // offset 직전 바이트의 해시 (0 이면 모름, truncate 후 다시 커진 파일 감지용)
+    std::size_t totalLines = 0;     // 로테이션을 넘어 누적된 라인 수
+    std::unordered_map<LogLevel, std::size_t> levelCounts;
+
+    // 누적 카운터를 통계에 더함
+    void addTo(Statistics& stats) const;
+};
+
+// 이번 실행에서 체크포인트 이후를 처리한 결과
+struct ResumeResult {
+    std::uintmax_t startOffset = 0;
+    std::size_t newLines = 0;
+    bool restarted = false;         // 로테이션/잘림으로 처음부터 다시 읽었음
+    std::string rotatedPath;        // 처음부터 다시 읽기 전에 남은 부분을 마저 읽은 이전 파일
+    std::size_t rotatedLines = 0;   // 그 파일에서 읽은 라인 수 (newLines 에도 포함)
+    bool rotatedMissing = false;    // 이전 파일을 찾지 못해 체크포인트 이후 기록을 건너뛰었을 수 있음
+};
+
+// cron 처럼 같은 파일을 반복 분석할 때 파일별 체크포인트를 보관하는 상태 파일
+// 한 줄에 파일 하나를 텍스트로 기록하며 저장은 임시 파일에 쓴 뒤 rename
+class CheckpointStore {
+public:
+    explicit CheckpointStore(const std::string& statePath);
+
+    // 상태 파일 읽기 (없으면 빈 상태로 true, 형식이 틀리면 false)
+    bool load();
+    bool save() const;
+
+    std::optional<FileCheckpoint> find(const std::string& filePath) const;
+    void update(const FileCheckpoint& checkpoint);
+
+    const std::vector<FileCheckpoint>& getCheckpoints() const noexcept;
+    const std::string& getStatePath() const noexcept;
+
+private:
+    std::string statePath_;
+    std::vector<FileCheckpoint> checkpoints_;
+};
+
+// 체크포인트 이후 추가된 완전한 라인만 파싱해 onEntry 로 넘기고 checkpoint 를 갱신
+// inode 가 바뀌었거나, 파일이 오프셋보다 작아졌거나, 오프셋 직전 내용(지문)이 달라졌으면
+// 처음부터 읽되 누적 카운터는 유지
+// 그 전에 로테이션된 이전 파일(<경로>.1 또는 <경로>-*)을 같은 inode 나 지문으로 찾으면
+// 체크포인트 오프셋부터 끝까지 마저 읽고, 찾지 못하면 건너뛴 기록이 있을 수 있다고 경고
+// 쓰는 중인(개행 없는) 마지막 라인은 다음 실행으로 미룸
+// 압축 파일은 중간부터 풀 수 없으므로 처음 보거나 inode 가 바뀌었을 때만 통째로 처리
+ResumeResult resumeFromCheckpoint(const std::string& filePath, FileCheckpoint& checkpoint,
+                                  const LogParser& parser,
+                                  const std::function<void(const LogEntry& entry)>& onEntry);
+
+} // namespace LogAnalyzer
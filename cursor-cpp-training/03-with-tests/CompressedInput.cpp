@@ -0,0 +1,434 @@
+#include "CompressedInput.hpp"
+#include "MappedFile.hpp"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+#include <system_error>
+
+#ifdef LOG_ANALYZER_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef LOG_ANALYZER_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace LogAnalyzer {
+
+namespace {
+
+#ifdef LOG_ANALYZER_HAS_ZLIB
+// 압축 파일에서 한 번에 읽는 크기와 풀어낸 블록 크기
+constexpr std::size_t GZIP_INPUT_BLOCK_SIZE = 256 * 1024;
+constexpr std::size_t GZIP_OUTPUT_BLOCK_SIZE = 1 << 20;
+
+// gzip 파일 전체를 풀어 큐에 블록 단위로 넣음 (연결된 여러 gzip 멤버도 처리)
+void inflateGzipFile(const std::string& filePath, BlockQueue& queue) {
+    std::ifstream input(filePath, std::ios::binary);
+    if (!input) {
+        std::cerr << "gzip 파일을 열 수 없습니다: " << filePath << std::endl;
+        queue.fail();
+        return;
+    }
+
+    z_stream stream{};
+    // windowBits 15 + 32: gzip/zlib 헤더 자동 판별
+    if (inflateInit2(&stream, 15 + 32) != Z_OK) {
+        std::cerr << "zlib 초기화 실패: " << filePath << std::endl;
+        queue.fail();
+        return;
+    }
+
+    std::vector<char> inputBlock(GZIP_INPUT_BLOCK_SIZE);
+    bool inMember = false;   // 멤버 중간에서 파일이 끝나면 잘린 파일
+    bool memberEnded = false;
+    bool corrupted = false;
+
+    while (!queue.isCancelled()) {
+        if (stream.avail_in == 0) {
+            input.read(inputBlock.data(), static_cast<std::streamsize>(inputBlock.size()));
+            std::streamsize n = input.gcount();
+            if (n <= 0) {
+                break;
+            }
+            stream.next_in = reinterpret_cast<Bytef*>(inputBlock.data());
+            stream.avail_in = static_cast<uInt>(n);
+        }
+
+        if (memberEnded) {
+            // cat a.gz b.gz 처럼 이어 붙은 다음 멤버
+            inflateReset(&stream);
+            memberEnded = false;
+        }
+
+        std::string outputBlock(GZIP_OUTPUT_BLOCK_SIZE, '\0');
+        stream.next_out = reinterpret_cast<Bytef*>(outputBlock.data());
+        stream.avail_out = static_cast<uInt>(outputBlock.size());
+
+        int result = inflate(&stream, Z_NO_FLUSH);
+        if (result != Z_OK && result != Z_STREAM_END && result != Z_BUF_ERROR) {
+            std::cerr << "gzip 압축 해제 실패: " << filePath
+                      << " (" << (stream.msg != nullptr ? stream.msg : "알 수 없는 오류") << ")" << std::endl;
+            corrupted = true;
+            break;
+        }
+        inMember = true;
+
+        outputBlock.resize(outputBlock.size() - stream.avail_out);
+        if (!outputBlock.empty() && !queue.push(std::move(outputBlock))) {
+            break;
+        }
+
+        if (result == Z_STREAM_END) {
+            inMember = false;
+            memberEnded = true;
+        }
+    }
+
+    if (input.bad()) {
+        std::cerr << "gzip 파일 읽기 실패: " << filePath << std::endl;
+        corrupted = true;
+    } else if (inMember && !corrupted && !queue.isCancelled()) {
+        std::cerr << "gzip 파일이 중간에 잘려 있습니다: " << filePath << std::endl;
+        corrupted = true;
+    }
+
+    inflateEnd(&stream);
+    if (corrupted) {
+        queue.fail();
+    }
+}
+#endif
+
+#ifdef LOG_ANALYZER_HAS_ZSTD
+// 스레드당 동시에 메모리에 풀어 둘 수 있는 프레임 수
+constexpr std::size_t ZSTD_FRAMES_IN_FLIGHT_PER_THREAD = 2;
+
+// 프레임 헤더의 원본 크기를 믿고 미리 할당하는 상한
+// (손상되었거나 조작된 헤더가 수 GB 를 요구해도 실제로 풀린 만큼만 메모리를 씀)
+constexpr unsigned long long ZSTD_MAX_PREALLOCATED_FRAME_SIZE = 64ULL << 20;
+
+// 압축 파일 안의 프레임 위치
+struct ZstdFrame {
+    std::size_t offset;
+    std::size_t size;
+};
+
+// 스레드별로 하나씩 사용하는 해제 컨텍스트 (RAII)
+class ZstdContext {
+public:
+    ZstdContext() : context_(ZSTD_createDCtx()) {}
+    ~ZstdContext() { ZSTD_freeDCtx(context_); }
+
+    ZstdContext(const ZstdContext&) = delete;
+    ZstdContext& operator=(const ZstdContext&) = delete;
+
+    ZSTD_DCtx* get() const noexcept { return context_; }
+
+private:
+    ZSTD_DCtx* context_;
+};
+
+// 스킵 가능 프레임 (매직 0x184D2A50 ~ 0x184D2A5F, 리틀 엔디언)
+bool isSkippableZstdFrame(const char* data, std::size_t size) {
+    if (size < 4) {
+        return false;
+    }
+    const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+    return (bytes[0] & 0xF0) == 0x50 && bytes[1] == 0x2A && bytes[2] == 0x4D && bytes[3] == 0x18;
+}
+
+// 프레임 헤더와 블록 헤더만 따라가며 프레임 경계를 찾음 (실패 시 빈 벡터)
+std::vector<ZstdFrame> findZstdFrames(std::string_view data) {
+    std::vector<ZstdFrame> frames;
+    std::size_t offset = 0;
+    while (offset < data.size()) {
+        std::size_t frameSize = ZSTD_findFrameCompressedSize(data.data() + offset, data.size() - offset);
+        if (ZSTD_isError(frameSize) || frameSize == 0) {
+            return {};
+        }
+        frames.push_back({offset, frameSize});
+        offset += frameSize;
+    }
+    return frames;
+}
+
+// 스트리밍 해제: output 콜백에 블록 단위로 전달, 마지막 프레임까지 온전히 끝나면 true
+bool streamZstd(ZSTD_DCtx* context, const char* src, std::size_t size,
+                const std::function<bool(const char*, std::size_t)>& output) {
+    ZSTD_DCtx_reset(context, ZSTD_reset_session_only);
+
+    std::vector<char> outputBlock(ZSTD_DStreamOutSize());
+    ZSTD_inBuffer input{src, size, 0};
+    std::size_t result = 0;
+    bool outputFull = false;
+
+    // 입력을 다 넘겨도 출력 버퍼가 가득 찼다면 내부에 남은 데이터가 있을 수 있음
+    while (input.pos < input.size || outputFull) {
+        ZSTD_outBuffer out{outputBlock.data(), outputBlock.size(), 0};
+        result = ZSTD_decompressStream(context, &out, &input);
+        if (ZSTD_isError(result)) {
+            std::cerr << "zstd 압축 해제 실패: " << ZSTD_getErrorName(result) << std::endl;
+            return false;
+        }
+        if (out.pos > 0 && !output(outputBlock.data(), out.pos)) {
+            return false;
+        }
+        outputFull = out.pos == out.size;
+    }
+
+    return result == 0;
+}
+
+// 프레임 하나를 메모리에 풂
+bool decodeZstdFrame(ZSTD_DCtx* context, const char* src, std::size_t size, std::string& decoded) {
+    decoded.clear();
+    if (isSkippableZstdFrame(src, size)) {
+        return true;
+    }
+
+    unsigned long long contentSize = ZSTD_getFrameContentSize(src, size);
+    if (contentSize == ZSTD_CONTENTSIZE_ERROR) {
+        std::cerr << "zstd 프레임 헤더가 올바르지 않습니다" << std::endl;
+        return false;
+    }
+
+    if (contentSize != ZSTD_CONTENTSIZE_UNKNOWN && contentSize <= ZSTD_MAX_PREALLOCATED_FRAME_SIZE) {
+        decoded.resize(static_cast<std::size_t>(contentSize));
+        std::size_t result = ZSTD_decompressDCtx(context, decoded.data(), decoded.size(), src, size);
+        if (ZSTD_isError(result)) {
+            std::cerr << "zstd 압축 해제 실패: " << ZSTD_getErrorName(result) << std::endl;
+            return false;
+        }
+        decoded.resize(result);
+        return true;
+    }
+
+    // 헤더에 원본 크기가 없거나 상한을 넘는 프레임은 스트리밍으로 풀어서 이어 붙임
+    return streamZstd(context, src, size, [&decoded](const char* data, std::size_t length) {
+        decoded.append(data, length);
+        return true;
+    });
+}
+
+// 단일 스레드: 전체 입력을 스트리밍으로 풀어 큐에 넣음 (프레임 크기와 무관하게 메모리 일정)
+void streamZstdFile(const std::string& filePath, std::string_view data, BlockQueue& queue) {
+    ZstdContext context;
+    bool complete = streamZstd(context.get(), data.data(), data.size(), [&queue](const char* block, std::size_t length) {
+        return queue.push(std::string(block, length));
+    });
+    if (!complete && !queue.isCancelled()) {
+        std::cerr << "zstd 파일이 중간에 잘렸거나 손상되었습니다: " << filePath << std::endl;
+        queue.fail();
+    }
+}
+
+// 독립 프레임들을 여러 스레드에서 풀고, 풀린 순서와 관계없이 파일 순서대로 큐에 넣음
+void decodeZstdFile(const std::string& filePath, std::size_t threadCount, BlockQueue& queue) {
+    MappedFile mappedFile(filePath);
+    if (!mappedFile.isValid()) {
+        // 실패 사유는 MappedFile 이 이미 보고함
+        queue.fail();
+        return;
+    }
+    std::string_view data = mappedFile.data();
+
+    std::vector<ZstdFrame> frames = findZstdFrames(data);
+    if (frames.size() <= 1 || threadCount <= 1) {
+        // 프레임이 하나뿐이거나 경계를 찾지 못하면 순차 스트리밍 (오류도 여기서 보고됨)
+        streamZstdFile(filePath, data, queue);
+        return;
+    }
+
+    // 프레임 결과 슬롯 (frameIndex % window 위치를 재사용)
+    struct Slot {
+        bool ready = false;
+        bool ok = false;
+        std::string data;
+    };
+
+    std::size_t window = threadCount * ZSTD_FRAMES_IN_FLIGHT_PER_THREAD;
+    std::vector<Slot> slots(window);
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::size_t nextToClaim = 0;
+    std::size_t nextToEmit = 0;
+    bool stopped = false;
+
+    auto worker = [&]() {
+        ZstdContext context;
+        std::string decoded;
+        while (true) {
+            std::size_t index = 0;
+            {
+                // 출력보다 window 이상 앞서 나가지 않도록 대기 (메모리 상한)
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&]() {
+                    return stopped || nextToClaim >= frames.size() || nextToClaim < nextToEmit + window;
+                });
+                if (stopped || nextToClaim >= frames.size()) {
+                    return;
+                }
+                index = nextToClaim++;
+            }
+
+            // 워커에서 빠져나간 예외는 프로세스를 종료시키므로 해제 실패로 바꿔 소비자에게 전달
+            const ZstdFrame& frame = frames[index];
+            bool ok = false;
+            try {
+                ok = decodeZstdFrame(context.get(), data.data() + frame.offset, frame.size, decoded);
+            } catch (const std::exception& e) {
+                std::cerr << "zstd 프레임 " << index << " 압축 해제 중 오류: " << e.what() << std::endl;
+                decoded = std::string();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            Slot& slot = slots[index % window];
+            slot.ok = ok;
+            slot.data = std::move(decoded);
+            slot.ready = true;
+            decoded = std::string();
+            changed.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    std::size_t workerCount = std::min(threadCount, frames.size());
+    for (std::size_t i = 0; i < workerCount; ++i) {
+        try {
+            workers.emplace_back(worker);
+        } catch (const std::system_error& e) {
+            // 스레드를 더 만들 수 없으면 이미 시작한 워커들로만 진행
+            std::cerr << "zstd 해제 스레드 생성 실패: " << e.what() << std::endl;
+            break;
+        }
+    }
+    if (workers.empty()) {
+        streamZstdFile(filePath, data, queue);
+        return;
+    }
+
+    for (std::size_t index = 0; index < frames.size(); ++index) {
+        std::string block;
+        bool ok = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            Slot& slot = slots[index % window];
+            changed.wait(lock, [&]() { return slot.ready; });
+            ok = slot.ok;
+            block = std::move(slot.data);
+            slot = Slot();
+            nextToEmit = index + 1;
+            changed.notify_all();
+        }
+
+        if (!ok) {
+            std::cerr << "zstd 프레임 " << index << " 압축 해제 실패: " << filePath << std::endl;
+            queue.fail();
+            break;
+        }
+        if (!block.empty() && !queue.push(std::move(block))) {
+            break;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopped = true;
+        changed.notify_all();
+    }
+    for (auto& thread : workers) {
+        thread.join();
+    }
+}
+#endif
+
+} // namespace
+
+Compression detectCompression(const std::string& filePath) {
+    std::ifstream file(filePath, std::ios::binary);
+    unsigned char magic[4] = {0, 0, 0, 0};
+    file.read(reinterpret_cast<char*>(magic), sizeof(magic));
+    std::streamsize n = file.gcount();
+
+    if (n >= 2 && magic[0] == 0x1F && magic[1] == 0x8B) {
+        return Compression::Gzip;
+    }
+    if (n >= 4 && magic[0] == 0x28 && magic[1] == 0xB5 && magic[2] == 0x2F && magic[3] == 0xFD) {
+        return Compression::Zstd;
+    }
+    return Compression::None;
+}
+
+DecodingStreamBuf::DecodingStreamBuf(Producer producer, std::size_t queueCapacity)
+    : queue_(queueCapacity) {
+    worker_ = std::thread([this, producer = std::move(producer)]() {
+        try {
+            producer(queue_);
+        } catch (const std::exception& e) {
+            std::cerr << "압축 해제 스레드 오류: " << e.what() << std::endl;
+            queue_.fail();
+        }
+        queue_.finish();
+    });
+}
+
+DecodingStreamBuf::~DecodingStreamBuf() {
+    queue_.cancel();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+DecodingStreamBuf::int_type DecodingStreamBuf::underflow() {
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+
+    auto block = queue_.pop();
+    while (block && block->empty()) {
+        block = queue_.pop();
+    }
+    if (!block) {
+        if (queue_.hasFailed()) {
+            setReadError();
+        }
+        return traits_type::eof();
+    }
+
+    current_ = std::move(*block);
+    char* begin = current_.data();
+    setg(begin, begin, begin + current_.size());
+    return traits_type::to_int_type(*gptr());
+}
+
+std::unique_ptr<InputStreamBuf> createGzipStreamBuf(const std::string& filePath) {
+#ifdef LOG_ANALYZER_HAS_ZLIB
+    return std::make_unique<DecodingStreamBuf>([filePath](BlockQueue& queue) {
+        inflateGzipFile(filePath, queue);
+    });
+#else
+    std::cerr << "gzip 지원 없이 빌드되었습니다 (zlib 필요): " << filePath << std::endl;
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<InputStreamBuf> createZstdStreamBuf(const std::string& filePath, std::size_t threadCount) {
+#ifdef LOG_ANALYZER_HAS_ZSTD
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return std::make_unique<DecodingStreamBuf>([filePath, threadCount](BlockQueue& queue) {
+        decodeZstdFile(filePath, threadCount, queue);
+    }, threadCount * 2);
+#else
+    (void)threadCount;
+    std::cerr << "zstd 지원 없이 빌드되었습니다 (libzstd 필요): " << filePath << std::endl;
+    return nullptr;
+#endif
+}
+
+} // namespace LogAnalyzer
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "BoundedQueue.hpp"
+#include <string>
+#include <memory>
+#include <thread>
+#include <functional>
+#include <streambuf>
+
+namespace LogAnalyzer {
+
+// 입력 파일의 압축 형식 (매직 바이트로 판별)
+enum class Compression {
+    None,
+    Gzip,
+    Zstd
+};
+
+// 파일 앞부분의 매직 바이트로 압축 형식 판별
+Compression detectCompression(const std::string& filePath);
+
+// 압축 해제 스레드(생산자)와 파서(소비자) 사이의 블록 큐
+using BlockQueue = BoundedQueue<std::string>;
+
+// 읽기 실패를 EOF 와 구분해 알려 주는 streambuf
+// underflow 는 실패해도 EOF 를 반환하므로 소비자는 EOF 를 만난 뒤 hasReadError() 로 확인
+class InputStreamBuf : public std::streambuf {
+public:
+    bool hasReadError() const noexcept { return readError_; }
+
+protected:
+    void setReadError() noexcept { readError_ = true; }
+
+private:
+    bool readError_ = false;
+};
+
+// 백그라운드 스레드가 풀어 넣은 블록을 순서대로 읽는 streambuf
+// std::istream 에 연결하면 std::getline 으로 압축 해제와 파싱이 겹쳐서 진행됨
+class DecodingStreamBuf : public InputStreamBuf {
+public:
+    // producer 는 별도 스레드에서 실행되며 큐를 채운 뒤 반환 (finish 는 자동 호출)
+    // 입력이 손상되었거나 읽기에 실패하면 queue.fail() 을 호출해 소비자가 EOF 와 구분하게 함
+    using Producer = std::function<void(BlockQueue&)>;
+
+    explicit DecodingStreamBuf(Producer producer, std::size_t queueCapacity = 8);
+    ~DecodingStreamBuf() override;
+
+    DecodingStreamBuf(const DecodingStreamBuf&) = delete;
+    DecodingStreamBuf& operator=(const DecodingStreamBuf&) = delete;
+
+protected:
+    int_type underflow() override;
+
+private:
+    BlockQueue queue_;
+    std::string current_;
+    std::thread worker_;
+};
+
+// gzip 파일을 스트리밍으로 풀어 주는 streambuf (zlib 없이 빌드되면 nullptr)
+std::unique_ptr<InputStreamBuf> createGzipStreamBuf(const std::string& filePath);
+
+// zstd 파일을 풀어 주는 streambuf (libzstd 없이 빌드되면 nullptr)
+// 독립 프레임이 여러 개면 threadCount 개의 스레드가 나눠 풀고 원래 순서대로 내보냄
+// threadCount 가 0 이면 하드웨어 스레드 수를 사용
+std::unique_ptr<InputStreamBuf> createZstdStreamBuf(const std::string& filePath, std::size_t threadCount = 0);
+
+} // namespace LogAnalyzer
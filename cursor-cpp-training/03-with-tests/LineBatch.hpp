@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+namespace LogAnalyzer {
+
+// 여러 라인을 하나의 연속 버퍼에 담는 묶음 (readLines 용)
+// clear() 는 용량을 유지하므로 같은 묶음을 반복해서 넘기면 라인마다 힙 할당이 생기지 않음
+class LineBatch {
+public:
+    std::size_t size() const noexcept { return offsets_.size() - 1; }
+    bool empty() const noexcept { return size() == 0; }
+    
+    // i 번째 라인 (개행 제외), 다음 readLines 호출 전까지 유효
+    std::string_view operator[](std::size_t i) const noexcept {
+        return std::string_view(bytes_.data() + offsets_[i], offsets_[i + 1] - offsets_[i]);
+    }
+    
+    void clear() noexcept {
+        bytes_.clear();
+        offsets_.resize(1);
+    }
+    
+    void reserve(std::size_t bytes, std::size_t lines) {
+        bytes_.reserve(bytes);
+        offsets_.reserve(lines + 1);
+    }
+    
+    void append(std::string_view line) {
+        bytes_.append(line.data(), line.size());
+        offsets_.push_back(bytes_.size());
+    }
+    
+    // 라인 바이트 전체 (라인 사이 구분자 없음)
+    std::string_view bytes() const noexcept { return bytes_; }
+    
+    // 라인 바이트 버퍼를 복사 없이 통째로 넘겨주고 묶음은 비움 (넘기기 전 i 번째 라인은 넘겨준 버퍼의 [offsets_[i], offsets_[i + 1]))
+    // 라인 위치 배열의 용량은 남지만 바이트 버퍼의 용량은 함께 넘어가므로 다음 append 에서 새로 할당함
+    std::string releaseBytes() noexcept {
+        std::string bytes = std::move(bytes_);
+        clear();
+        return bytes;
+    }
+
+private:
+    std::string bytes_;
+    std::vector<std::size_t> offsets_{0};  // 라인 i 는 [offsets_[i], offsets_[i + 1])
+};
+
+} // namespace LogAnalyzer
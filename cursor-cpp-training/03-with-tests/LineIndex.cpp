@@ -0,0 +1,286 @@
+#include "LineIndex.hpp"
+#include "PosixFile.hpp"
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <sys/stat.h>
+
+namespace LogAnalyzer {
+
+namespace {
+
+// 인덱스 생성 시 한 번에 읽는 블록 크기
+constexpr std::size_t INDEX_READ_BLOCK_SIZE = 1 << 20;
+
+// sidecar 파일 머리 (형식이 바뀌면 버전을 올려 이전 파일을 무효화)
+constexpr char SIDECAR_MAGIC[4] = {'L', 'I', 'D', 'X'};
+constexpr std::uint32_t SIDECAR_VERSION = 2;
+
+// 이어서 인덱싱하기 전 기존 범위가 그대로인지 확인할 때 해시하는 앞/끝 블록 크기
+constexpr std::size_t CONTENT_CHECK_SIZE = 4096;
+
+struct SidecarHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint64_t fileSize;
+    std::int64_t modifiedTimeNs;
+    std::uint64_t sampleInterval;
+    std::uint64_t lineCount;
+    std::uint64_t sampleCount;
+    std::uint64_t contentHash;
+};
+
+// 파일 크기와 수정 시각(ns), 조회 실패 시 false
+bool statFile(const std::string& filePath, std::uintmax_t& size, std::int64_t& modifiedTimeNs) {
+    struct stat info {};
+    if (::stat(filePath.c_str(), &info) != 0 || !S_ISREG(info.st_mode)) {
+        return false;
+    }
+    size = static_cast<std::uintmax_t>(info.st_size);
+    modifiedTimeNs = static_cast<std::int64_t>(info.st_mtim.tv_sec) * 1000000000 + info.st_mtim.tv_nsec;
+    return true;
+}
+
+// [0, size) 의 앞 블록과 끝 블록을 이어 FNV-1a 해시, 읽기 실패 시 false
+bool hashIndexedRange(int fd, std::uintmax_t size, std::uint64_t& hash) {
+    std::size_t headLength = static_cast<std::size_t>(std::min<std::uintmax_t>(size, CONTENT_CHECK_SIZE));
+    std::size_t tailLength = static_cast<std::size_t>(std::min<std::uintmax_t>(size - headLength, CONTENT_CHECK_SIZE));
+
+    std::vector<char> bytes(headLength + tailLength);
+    if (preadFully(fd, bytes.data(), headLength, 0) != static_cast<ssize_t>(headLength) ||
+        preadFully(fd, bytes.data() + headLength, tailLength, size - tailLength) != static_cast<ssize_t>(tailLength)) {
+        return false;
+    }
+
+    hash = fnv1aHash(bytes.data(), bytes.size());
+    return true;
+}
+
+} // namespace
+
+std::optional<LineIndex> LineIndex::build(const std::string& filePath, std::size_t sampleInterval) {
+    LineIndex index;
+    index.filePath_ = filePath;
+    index.sampleInterval_ = std::max<std::size_t>(sampleInterval, 1);
+    std::uintmax_t fileSize = 0;
+    if (!statFile(filePath, fileSize, index.modifiedTimeNs_)) {
+        std::cerr << "라인 인덱스 생성 실패: " << filePath << std::endl;
+        return std::nullopt;
+    }
+
+    ScopedFd fd(filePath);
+    if (!fd.isOpen()) {
+        std::cerr << "라인 인덱스 생성 실패: " << filePath << " (" << std::strerror(errno) << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    if (!index.scanFrom(fd.get(), fileSize)) {
+        std::cerr << "라인 인덱스 생성 중 읽기 실패: " << filePath << std::endl;
+        return std::nullopt;
+    }
+    return index;
+}
+
+std::optional<LineIndex> LineIndex::fromScan(const std::string& filePath, std::size_t sampleInterval,
+                                             std::size_t lineCount, std::vector<std::uintmax_t> sampleOffsets,
+                                             std::uintmax_t scannedSize) {
+    LineIndex index;
+    index.filePath_ = filePath;
+    index.sampleInterval_ = std::max<std::size_t>(sampleInterval, 1);
+    if (!statFile(filePath, index.fileSize_, index.modifiedTimeNs_) || index.fileSize_ != scannedSize) {
+        return std::nullopt;
+    }
+
+    ScopedFd fd(filePath);
+    if (!fd.isOpen() || !hashIndexedRange(fd.get(), index.fileSize_, index.contentHash_)) {
+        return std::nullopt;
+    }
+
+    index.lineCount_ = lineCount;
+    index.sampleOffsets_ = std::move(sampleOffsets);
+    return index;
+}
+
+bool LineIndex::scanFrom(int fd, std::uintmax_t fileSize) {
+    // 마지막 표본 라인부터 다시 세므로 그 뒤의 라인 수와 표본은 새로 채움
+    std::uintmax_t offset = 0;
+    std::size_t newlineCount = 0;
+    if (sampleOffsets_.empty()) {
+        if (fileSize > 0) {
+            sampleOffsets_.push_back(0);
+        }
+    } else {
+        offset = sampleOffsets_.back();
+        newlineCount = (sampleOffsets_.size() - 1) * sampleInterval_;
+    }
+
+    // 개행마다 다음 라인이 시작되며 sampleInterval 라인마다 그 시작 위치를 기록
+    std::vector<char> block(INDEX_READ_BLOCK_SIZE);
+    char lastByte = '\n';  // 표본은 라인 시작이므로 바로 앞 바이트는 개행
+    while (offset < fileSize) {
+        std::size_t toRead = static_cast<std::size_t>(std::min<std::uintmax_t>(block.size(), fileSize - offset));
+        ssize_t n = preadFully(fd, block.data(), toRead, offset);
+        if (n <= 0) {
+            return false;
+        }
+
+        const char* pos = block.data();
+        const char* end = block.data() + n;
+        while (const char* newline = static_cast<const char*>(std::memchr(pos, '\n', static_cast<std::size_t>(end - pos)))) {
+            ++newlineCount;
+            std::uintmax_t nextLineStart = offset + static_cast<std::uintmax_t>(newline - block.data()) + 1;
+            if (newlineCount % sampleInterval_ == 0 && nextLineStart < fileSize) {
+                sampleOffsets_.push_back(nextLineStart);
+            }
+            pos = newline + 1;
+        }
+
+        lastByte = block[static_cast<std::size_t>(n) - 1];
+        offset += static_cast<std::uintmax_t>(n);
+    }
+
+    // std::getline 과 동일하게 개행 없이 끝나는 마지막 라인도 한 라인
+    lineCount_ = newlineCount + (lastByte != '\n' ? 1 : 0);
+    fileSize_ = fileSize;
+    return hashIndexedRange(fd, fileSize_, contentHash_);
+}
+
+bool LineIndex::extend() {
+    std::uintmax_t fileSize = 0;
+    std::int64_t modifiedTimeNs = 0;
+    if (!statFile(filePath_, fileSize, modifiedTimeNs) || fileSize < fileSize_) {
+        return false;
+    }
+
+    ScopedFd fd(filePath_);
+    std::uint64_t hash = 0;
+    if (!fd.isOpen() || !hashIndexedRange(fd.get(), fileSize_, hash) || hash != contentHash_) {
+        return false;
+    }
+
+    // 추가만 되었으면 수정 시각은 바뀌어도 기존 표본은 그대로 유효
+    modifiedTimeNs_ = modifiedTimeNs;
+    return scanFrom(fd.get(), fileSize);
+}
+
+std::optional<LineIndex> LineIndex::readSidecar(const std::string& filePath) {
+    std::ifstream input(sidecarPath(filePath), std::ios::binary);
+    if (!input) {
+        return std::nullopt;
+    }
+
+    SidecarHeader header {};
+    if (!input.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, SIDECAR_MAGIC, sizeof(SIDECAR_MAGIC)) != 0 ||
+        header.version != SIDECAR_VERSION || header.sampleInterval == 0) {
+        return std::nullopt;
+    }
+
+    std::uint64_t expectedSamples = header.lineCount == 0 ? 0 : (header.lineCount - 1) / header.sampleInterval + 1;
+    if (header.sampleCount != expectedSamples) {
+        return std::nullopt;
+    }
+
+    LineIndex index;
+    index.filePath_ = filePath;
+    index.fileSize_ = header.fileSize;
+    index.modifiedTimeNs_ = header.modifiedTimeNs;
+    index.contentHash_ = header.contentHash;
+    index.sampleInterval_ = static_cast<std::size_t>(header.sampleInterval);
+    index.lineCount_ = static_cast<std::size_t>(header.lineCount);
+
+    std::vector<std::uint64_t> offsets(static_cast<std::size_t>(header.sampleCount));
+    if (!input.read(reinterpret_cast<char*>(offsets.data()), static_cast<std::streamsize>(offsets.size() * sizeof(std::uint64_t)))) {
+        return std::nullopt;
+    }
+    index.sampleOffsets_.assign(offsets.begin(), offsets.end());
+    return index;
+}
+
+std::optional<LineIndex> LineIndex::load(const std::string& filePath) {
+    auto index = readSidecar(filePath);
+    if (!index) {
+        return std::nullopt;
+    }
+
+    // 원본 파일이 바뀌었으면 오프셋을 믿을 수 없음
+    std::uintmax_t fileSize = 0;
+    std::int64_t modifiedTimeNs = 0;
+    if (!statFile(filePath, fileSize, modifiedTimeNs) ||
+        fileSize != index->fileSize_ || modifiedTimeNs != index->modifiedTimeNs_) {
+        return std::nullopt;
+    }
+    return index;
+}
+
+std::optional<LineIndex> LineIndex::loadOrBuild(const std::string& filePath, std::size_t sampleInterval) {
+    if (auto index = load(filePath)) {
+        return index;
+    }
+
+    // 로그가 뒤에 추가되기만 했으면 기존 표본은 그대로 두고 늘어난 부분만 훑음
+    if (auto stale = readSidecar(filePath); stale && stale->extend()) {
+        stale->save();
+        return stale;
+    }
+
+    auto index = build(filePath, sampleInterval);
+    if (index) {
+        index->save();
+    }
+    return index;
+}
+
+bool LineIndex::save() const {
+    SidecarHeader header {};
+    std::memcpy(header.magic, SIDECAR_MAGIC, sizeof(SIDECAR_MAGIC));
+    header.version = SIDECAR_VERSION;
+    header.fileSize = fileSize_;
+    header.modifiedTimeNs = modifiedTimeNs_;
+    header.sampleInterval = sampleInterval_;
+    header.lineCount = lineCount_;
+    header.sampleCount = sampleOffsets_.size();
+    header.contentHash = contentHash_;
+
+    std::string bytes(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (std::uintmax_t offset : sampleOffsets_) {
+        std::uint64_t value = offset;
+        bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    // 다른 프로세스가 반쯤 쓴 sidecar 를 읽지 않도록 고유한 임시 파일을 완성한 뒤 교체
+    return replaceFileContents(sidecarPath(filePath_), bytes.data(), bytes.size());
+}
+
+std::string LineIndex::sidecarPath(const std::string& filePath) {
+    return filePath + ".lidx";
+}
+
+std::pair<std::size_t, std::uintmax_t> LineIndex::nearestSample(std::size_t lineNumber) const noexcept {
+    if (sampleOffsets_.empty() || lineNumber <= 1) {
+        return {1, 0};
+    }
+
+    std::size_t sample = std::min((lineNumber - 1) / sampleInterval_, sampleOffsets_.size() - 1);
+    return {sample * sampleInterval_ + 1, sampleOffsets_[sample]};
+}
+
+std::size_t LineIndex::getLineCount() const noexcept {
+    return lineCount_;
+}
+
+std::size_t LineIndex::getSampleInterval() const noexcept {
+    return sampleInterval_;
+}
+
+std::uintmax_t LineIndex::getFileSize() const noexcept {
+    return fileSize_;
+}
+
+const std::vector<std::uintmax_t>& LineIndex::getSampleOffsets() const noexcept {
+    return sampleOffsets_;
+}
+
+} // namespace LogAnalyzer
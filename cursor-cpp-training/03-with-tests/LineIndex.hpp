@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <optional>
+
+namespace LogAnalyzer {
+
+// 라인 번호 → 바이트 오프셋 표본 인덱스 (sampleInterval 번째 라인마다 하나)
+// 로그 파일 옆 "<파일>.lidx" 에 저장해 두고 파일 크기/수정 시각이 같을 때만 그대로 재사용
+// 파일이 커지기만 했고 인덱싱한 범위의 내용(앞/끝 블록 해시)이 같으면 마지막 표본부터 이어서 인덱싱
+// 임의의 라인은 가장 가까운 표본에서 pread 로 최대 sampleInterval - 1 라인만 건너뛰면 도달함
+class LineIndex {
+public:
+    static constexpr std::size_t DEFAULT_SAMPLE_INTERVAL = 4096;
+
+    // 파일 전체를 한 번 훑어 인덱스 생성 (읽기 실패 시 std::nullopt)
+    static std::optional<LineIndex> build(const std::string& filePath,
+                                          std::size_t sampleInterval = DEFAULT_SAMPLE_INTERVAL);
+
+    // sidecar 읽기 (없거나 손상됐거나 파일이 바뀌었으면 std::nullopt)
+    static std::optional<LineIndex> load(const std::string& filePath);
+
+    // sidecar 를 읽고, 쓸 수 없으면 이어서 인덱싱하거나 새로 만들어 저장 (저장 실패는 무시하고 인덱스는 반환)
+    static std::optional<LineIndex> loadOrBuild(const std::string& filePath,
+                                                std::size_t sampleInterval = DEFAULT_SAMPLE_INTERVAL);
+
+    // 이미 순차로 읽으며 모은 표본으로 인덱스 생성 (다시 훑지 않음)
+    // sampleOffsets 는 build 와 같은 규칙, scannedSize 는 읽은 바이트 수이며
+    // 그 사이 파일이 바뀌어 현재 크기와 다르면 std::nullopt
+    static std::optional<LineIndex> fromScan(const std::string& filePath, std::size_t sampleInterval,
+                                             std::size_t lineCount, std::vector<std::uintmax_t> sampleOffsets,
+                                             std::uintmax_t scannedSize);
+
+    // 파일이 커지기만 했으면 마지막 표본부터 새 끝까지 이어서 인덱싱
+    // 인덱싱한 범위의 내용이 바뀌었거나(truncate 후 다시 씀 등) 읽기에 실패하면 false
+    bool extend();
+
+    // sidecar 저장 (임시 파일에 쓴 뒤 rename)
+    bool save() const;
+
+    static std::string sidecarPath(const std::string& filePath);
+
+    // lineNumber(1부터) 이하에서 가장 가까운 표본 라인의 번호와 시작 오프셋
+    std::pair<std::size_t, std::uintmax_t> nearestSample(std::size_t lineNumber) const noexcept;
+
+    std::size_t getLineCount() const noexcept;
+    std::size_t getSampleInterval() const noexcept;
+    std::uintmax_t getFileSize() const noexcept;
+    const std::vector<std::uintmax_t>& getSampleOffsets() const noexcept;
+
+private:
+    std::string filePath_;
+    std::uintmax_t fileSize_ = 0;
+    std::int64_t modifiedTimeNs_ = 0;
+    std::uint64_t contentHash_ = 0;  // [0, fileSize_) 의 앞/끝 블록 해시
+    std::size_t sampleInterval_ = DEFAULT_SAMPLE_INTERVAL;
+    std::size_t lineCount_ = 0;
+    std::vector<std::uintmax_t> sampleOffsets_;  // [k] = (k * sampleInterval_ + 1) 번째 라인 시작
+
+    LineIndex() = default;
+
+    // sidecar 를 원본 파일과 대조하지 않고 읽음
+    static std::optional<LineIndex> readSidecar(const std::string& filePath);
+
+    // 마지막 표본부터 fileSize 까지 훑어 표본과 라인 수를 채움
+    bool scanFrom(int fd, std::uintmax_t fileSize);
+};
+
+} // namespace LogAnalyzer
@@ -0,0 +1,175 @@
+#include "LineSplitter.hpp"
+#include <cstring>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define LOG_ANALYZER_X86 1
+#endif
+
+namespace LogAnalyzer {
+
+namespace {
+
+std::size_t findNewlinesScalar(const char* data, std::size_t size, std::size_t base,
+                               std::vector<std::size_t>& offsets) {
+    std::size_t found = 0;
+    const char* pos = data;
+    const char* end = data + size;
+    while (pos < end) {
+        const char* newline = static_cast<const char*>(std::memchr(pos, '\n', static_cast<std::size_t>(end - pos)));
+        if (newline == nullptr) {
+            break;
+        }
+        offsets.push_back(base + static_cast<std::size_t>(newline - data));
+        ++found;
+        pos = newline + 1;
+    }
+    return found;
+}
+
+#ifdef LOG_ANALYZER_X86
+
+// 마스크의 set 비트마다 오프셋 하나를 out 에 기록
+inline std::size_t* writeMask(std::uint64_t mask, std::size_t position, std::size_t* out) {
+    while (mask != 0) {
+        *out++ = position + static_cast<std::size_t>(__builtin_ctzll(mask));
+        mask &= mask - 1;
+    }
+    return out;
+}
+
+// SIMD 비교가 끝나지 않은 나머지 바이트
+inline std::size_t* writeTail(const char* data, std::size_t from, std::size_t size, std::size_t base, std::size_t* out) {
+    for (std::size_t i = from; i < size; ++i) {
+        if (data[i] == '\n') {
+            *out++ = base + i;
+        }
+    }
+    return out;
+}
+
+inline std::size_t countTail(const char* data, std::size_t from, std::size_t size) {
+    std::size_t count = 0;
+    for (std::size_t i = from; i < size; ++i) {
+        count += data[i] == '\n';
+    }
+    return count;
+}
+
+// 64바이트에서 개행 위치 비트마스크
+__attribute__((target("sse2")))
+inline std::uint64_t newlineMask64Sse2(const char* data, __m128i newline) {
+    std::uint64_t mask = 0;
+    for (int k = 0; k < 4; ++k) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + k * 16));
+        auto part = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, newline)));
+        mask |= static_cast<std::uint64_t>(part) << (k * 16);
+    }
+    return mask;
+}
+
+// 개행 수를 먼저 세어 offsets 를 한 번만 늘린 뒤 두 번째 훑기에서 채움
+// (개행마다 push_back 하는 것보다 짧은 라인에서 훨씬 빠르며, 블록은 캐시에 남아 있어 두 번 읽는 비용이 작음)
+__attribute__((target("sse2")))
+std::size_t findNewlinesSse2(const char* data, std::size_t size, std::size_t base,
+                             std::vector<std::size_t>& offsets) {
+    const __m128i newline = _mm_set1_epi8('\n');
+    std::size_t simdEnd = size - size % 64;
+
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < simdEnd; i += 64) {
+        found += static_cast<std::size_t>(__builtin_popcountll(newlineMask64Sse2(data + i, newline)));
+    }
+    found += countTail(data, simdEnd, size);
+
+    std::size_t index = offsets.size();
+    offsets.resize(index + found);
+    std::size_t* out = offsets.data() + index;
+    for (std::size_t i = 0; i < simdEnd; i += 64) {
+        out = writeMask(newlineMask64Sse2(data + i, newline), base + i, out);
+    }
+    writeTail(data, simdEnd, size, base, out);
+    return found;
+}
+
+__attribute__((target("avx2")))
+inline std::uint64_t newlineMask64(const char* data, __m256i newline) {
+    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+    auto lowMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, newline)));
+    auto highMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, newline)));
+    return static_cast<std::uint64_t>(highMask) << 32 | lowMask;
+}
+
+__attribute__((target("avx2,popcnt")))
+std::size_t findNewlinesAvx2(const char* data, std::size_t size, std::size_t base,
+                             std::vector<std::size_t>& offsets) {
+    const __m256i newline = _mm256_set1_epi8('\n');
+    std::size_t simdEnd = size - size % 64;
+
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < simdEnd; i += 64) {
+        found += static_cast<std::size_t>(__builtin_popcountll(newlineMask64(data + i, newline)));
+    }
+    found += countTail(data, simdEnd, size);
+
+    std::size_t index = offsets.size();
+    offsets.resize(index + found);
+    std::size_t* out = offsets.data() + index;
+    for (std::size_t i = 0; i < simdEnd; i += 64) {
+        out = writeMask(newlineMask64(data + i, newline), base + i, out);
+    }
+    writeTail(data, simdEnd, size, base, out);
+    return found;
+}
+
+#endif
+
+SplitBackend detectSplitBackend() noexcept {
+#ifdef LOG_ANALYZER_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        return SplitBackend::Avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SplitBackend::Sse2;
+    }
+#endif
+    return SplitBackend::Scalar;
+}
+
+} // namespace
+
+SplitBackend bestSplitBackend() noexcept {
+    static const SplitBackend backend = detectSplitBackend();
+    return backend;
+}
+
+std::size_t findNewlines(const char* data, std::size_t size, std::size_t base, std::vector<std::size_t>& offsets) {
+    return findNewlines(data, size, base, offsets, bestSplitBackend());
+}
+
+std::size_t findNewlines(const char* data, std::size_t size, std::size_t base, std::vector<std::size_t>& offsets,
+                         SplitBackend backend) {
+    switch (backend) {
+#ifdef LOG_ANALYZER_X86
+        case SplitBackend::Avx2:
+            if (bestSplitBackend() == SplitBackend::Avx2) {
+                return findNewlinesAvx2(data, size, base, offsets);
+            }
+            [[fallthrough]];
+        case SplitBackend::Sse2:
+            if (bestSplitBackend() != SplitBackend::Scalar) {
+                return findNewlinesSse2(data, size, base, offsets);
+            }
+            break;
+#endif
+        default:
+            break;
+    }
+    // 요청한 구현을 이 CPU 가 지원하지 않으면 스칼라로 대체
+    return findNewlinesScalar(data, size, base, offsets);
+}
+
+} // namespace LogAnalyzer
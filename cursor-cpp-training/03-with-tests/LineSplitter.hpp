@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+namespace LogAnalyzer {
+
+// 개행 탐색 구현
+enum class SplitBackend {
+    Scalar,     // memchr 반복
+    Sse2,       // 16바이트씩 비교 (x86-64 기본)
+    Avx2        // 32바이트씩 비교 (런타임에 CPU 지원 확인)
+};
+
+// 이 CPU 에서 쓸 수 있는 가장 빠른 구현
+SplitBackend bestSplitBackend() noexcept;
+
+// data[0, size) 의 모든 '\n' 위치에 base 를 더해 offsets 뒤에 한꺼번에 추가하고 찾은 개수를 반환
+// 라인마다 memchr 를 호출하는 대신 버퍼 전체를 한 번에 훑어 오프셋 배열을 만듦
+std::size_t findNewlines(const char* data, std::size_t size, std::size_t base, std::vector<std::size_t>& offsets);
+std::size_t findNewlines(const char* data, std::size_t size, std::size_t base, std::vector<std::size_t>& offsets,
+                         SplitBackend backend);
+
+// CRLF 로 끝나는 라인의 '\r' 제거
+inline std::string_view stripCarriageReturn(std::string_view line) noexcept {
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+} // namespace LogAnalyzer
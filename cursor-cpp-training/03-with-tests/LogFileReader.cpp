@@ -1,16 +1,282 @@
 #include "LogFileReader.hpp"
+#include "PosixFile.hpp"
+#include "LineSplitter.hpp"
 #include <iostream>
+#include <fstream>
 #include <stdexcept>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <cmath>
+#include <random>
+#include <unistd.h>
 
 namespace LogAnalyzer {
 
-LogFileReader::LogFileReader(const std::string& filePath) 
-    : filePath_(filePath), isValid_(false) {
+namespace {
+
+// 구간 스캔 시 한 번에 읽는 블록 크기
+constexpr std::size_t CHUNK_READ_BLOCK_SIZE = 1 << 20;
+
+// 경계 정렬 시 개행을 찾기 위해 읽는 블록 크기
+constexpr std::size_t ALIGN_READ_BLOCK_SIZE = 64 * 1024;
+
+// 표준 입력 읽기 버퍼 크기 (파이프에서 read 호출 횟수를 줄임)
+constexpr std::size_t STDIN_BUFFER_SIZE = 1 << 20;
+
+// 스트림 모드에서 한 번에 읽어 개행을 찾는 블록 크기
+constexpr std::size_t STREAM_READ_BLOCK_SIZE = 256 * 1024;
+
+// 매핑 모드에서 한 번에 개행을 찾아 두는 범위
+constexpr std::size_t MAPPED_SCAN_WINDOW = 256 * 1024;
+
+// 파일 디스크립터를 큰 버퍼 하나로 반복해서 읽는 streambuf (std::cin 의 stdio 동기화를 피함)
+class FdStreamBuf : public InputStreamBuf {
+public:
+    FdStreamBuf(int fd, std::size_t bufferSize) : fd_(fd), buffer_(bufferSize) {
+        setg(buffer_.data(), buffer_.data(), buffer_.data());
+    }
+
+protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+        
+        ssize_t n;
+        do {
+            n = ::read(fd_, buffer_.data(), buffer_.size());
+        } while (n < 0 && errno == EINTR);
+        
+        if (n <= 0) {
+            if (n < 0) {
+                setReadError();
+            }
+            return traits_type::eof();
+        }
+        setg(buffer_.data(), buffer_.data(), buffer_.data() + n);
+        return traits_type::to_int_type(*gptr());
+    }
+    
+    // 버퍼에 남은 바이트가 있으면 그것만, 없으면 read 한 번만 (파이프에서 count 만큼 찰 때까지 기다리지 않음)
+    std::streamsize xsgetn(char* s, std::streamsize count) override {
+        if (gptr() < egptr()) {
+            std::streamsize available = std::min<std::streamsize>(count, egptr() - gptr());
+            std::memcpy(s, gptr(), static_cast<std::size_t>(available));
+            gbump(static_cast<int>(available));
+            return available;
+        }
+        
+        ssize_t n;
+        do {
+            n = ::read(fd_, s, static_cast<std::size_t>(count));
+        } while (n < 0 && errno == EINTR);
+        if (n < 0) {
+            setReadError();
+        }
+        return n > 0 ? static_cast<std::streamsize>(n) : 0;
+    }
+
+private:
+    int fd_;
+    std::vector<char> buffer_;
+};
+
+// offset 이 속한 라인의 다음 라인 시작 위치 (offset 이 이미 라인 시작이면 그대로)
+std::uintmax_t alignToLineStart(int fd, std::uintmax_t offset, std::uintmax_t fileSize) {
+    if (offset == 0 || offset >= fileSize) {
+        return std::min(offset, fileSize);
+    }
+    
+    std::vector<char> block(ALIGN_READ_BLOCK_SIZE);
+    std::uintmax_t pos = offset - 1;
+    while (pos < fileSize) {
+        std::size_t toRead = static_cast<std::size_t>(std::min<std::uintmax_t>(block.size(), fileSize - pos));
+        ssize_t n = preadFully(fd, block.data(), toRead, pos);
+        if (n <= 0) {
+            break;
+        }
+        const void* newline = std::memchr(block.data(), '\n', static_cast<std::size_t>(n));
+        if (newline != nullptr) {
+            return pos + static_cast<std::uintmax_t>(static_cast<const char*>(newline) - block.data()) + 1;
+        }
+        pos += static_cast<std::uintmax_t>(n);
+    }
+    return fileSize;
+}
+
+// [offset, offset + length) 구간의 개행 문자 수
+std::optional<std::size_t> countNewlines(int fd, std::uintmax_t offset, std::uintmax_t length) {
+    std::vector<char> block(CHUNK_READ_BLOCK_SIZE);
+    std::size_t count = 0;
+    std::uintmax_t done = 0;
+    while (done < length) {
+        std::size_t toRead = static_cast<std::size_t>(std::min<std::uintmax_t>(block.size(), length - done));
+        ssize_t n = preadFully(fd, block.data(), toRead, offset + done);
+        if (n <= 0) {
+            // 읽기 오류이거나 그사이 파일이 줄어듦
+            return std::nullopt;
+        }
+        count += static_cast<std::size_t>(std::count(block.data(), block.data() + n, '\n'));
+        done += static_cast<std::uintmax_t>(n);
+    }
+    return count;
+}
+
+// [offset, offset + length) 구간의 라인을 순서대로 콜백에 넘김 (콜백이 false 를 반환하면 중단)
+// 라인 길이로 위치를 계산하는 호출자가 있으므로 CRLF 의 '\r' 은 떼지 않음
+// 블록 경계에 걸친 라인만 carry 에 복사하고 나머지는 읽기 블록을 가리키는 뷰로 넘김
+void forEachLineFrom(int fd, std::uintmax_t offset, std::uintmax_t length, std::size_t firstLineNumber,
+                     const std::function<bool(std::string_view line, std::size_t lineNumber)>& callback,
+                     std::size_t blockSize = CHUNK_READ_BLOCK_SIZE) {
+    std::vector<char> block(blockSize);
+    std::vector<std::size_t> newlines;
+    std::string carry; // 블록 경계에 걸친 라인 조각
+    std::size_t lineNumber = firstLineNumber;
+    std::uintmax_t done = 0;
+    
+    while (done < length) {
+        std::size_t toRead = static_cast<std::size_t>(std::min<std::uintmax_t>(block.size(), length - done));
+        ssize_t n = preadFully(fd, block.data(), toRead, offset + done);
+        if (n <= 0) {
+            break;
+        }
+        done += static_cast<std::uintmax_t>(n);
+        
+        // 블록의 개행을 한 번에 찾은 뒤 라인을 차례로 내보냄
+        newlines.clear();
+        findNewlines(block.data(), static_cast<std::size_t>(n), 0, newlines);
+        
+        std::size_t pos = 0;
+        for (std::size_t newline : newlines) {
+            bool keepGoing;
+            if (carry.empty()) {
+                keepGoing = callback(std::string_view(block.data() + pos, newline - pos), lineNumber++);
+            } else {
+                carry.append(block.data() + pos, newline - pos);
+                keepGoing = callback(std::string_view(carry), lineNumber++);
+                carry.clear();
+            }
+            if (!keepGoing) {
+                return;
+            }
+            pos = newline + 1;
+        }
+        carry.append(block.data() + pos, static_cast<std::size_t>(n) - pos);
+    }
+    
+    // 개행 없이 끝나는 마지막 라인
+    if (!carry.empty()) {
+        callback(std::string_view(carry), lineNumber);
+    }
+}
+
+// offset 이후 처음으로 타임스탬프가 key 이상인 라인의 시작 위치 (없으면 fileSize)
+// 파일이 시간순으로 기록되어 있다고 보고 바이트 오프셋을 이분 탐색하며,
+// 탐색 지점마다 다음 라인 시작으로 맞춘 뒤 타임스탬프가 있는 첫 라인만 파싱
+std::uintmax_t lowerBoundByTimestamp(int fd, std::uintmax_t fileSize, const LogParser& parser, const std::string& key) {
+    std::string line;
+    
+    // from 이후 타임스탬프가 있는 첫 라인의 (시작 위치, 타임스탬프)
+    auto probe = [&](std::uintmax_t from) {
+        std::uintmax_t lineStart = alignToLineStart(fd, from, fileSize);
+        std::pair<std::uintmax_t, std::string> found{fileSize, ""};
+        forEachLineFrom(fd, lineStart, fileSize - lineStart, 1, [&](std::string_view view, std::size_t) {
+            line.assign(view);
+            std::string timestamp = parser.extractTimestamp(line);
+            if (timestamp.empty()) {
+                lineStart += view.size() + 1;
+                return true;
+            }
+            found = {lineStart, std::move(timestamp)};
+            return false;
+        }, ALIGN_READ_BLOCK_SIZE);
+        return found;
+    };
+    
+    std::uintmax_t low = 0;
+    std::uintmax_t high = fileSize;
+    while (low < high) {
+        std::uintmax_t mid = low + (high - low) / 2;
+        auto [lineStart, timestamp] = probe(mid);
+        if (lineStart == fileSize || timestamp >= key) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return probe(low).first;
+}
+
+} // namespace
+
+LogFileReader::LogFileReader(const std::string& filePath, ReadMode mode) 
+    : filePath_(filePath), mode_(mode), compression_(Compression::None),
+      mappedPos_(0), mappedScanPos_(0), bufferBegin_(0), bufferEnd_(0), nextNewline_(0),
+      lineIndexSaved_(false), scanLineCount_(0), scanTracking_(false), streamBytesRead_(0), lastLineTerminated_(true), isValid_(false) {
+    if (isStandardInput()) {
+        // 파이프는 매핑하거나 매직 바이트를 미리 볼 수 없으므로 평문 스트림으로만 읽음
+        mode_ = ReadMode::Stream;
+        decodeBuffer_ = std::make_unique<FdStreamBuf>(STDIN_FILENO, STDIN_BUFFER_SIZE);
+        input_ = std::make_unique<std::istream>(decodeBuffer_.get());
+        isValid_ = true;
+        return;
+    }
+    
     validateFile();
-    if (isValid_) {
-        fileStream_.open(filePath_);
-        isValid_ = fileStream_.is_open();
+    if (!isValid_) {
+        return;
     }
+    
+    compression_ = detectCompression(filePath_);
+    if (compression_ != Compression::None) {
+        // 압축 데이터는 매핑해도 라인 뷰를 만들 수 없으므로 스트림으로 풀어서 읽음
+        mode_ = ReadMode::Stream;
+    }
+    
+    if (mode_ == ReadMode::MemoryMapped) {
+        mappedFile_ = MappedFile(filePath_);
+        isValid_ = mappedFile_.isValid();
+    } else {
+        isValid_ = openStream();
+    }
+    restartIndexScan();
+}
+
+bool LogFileReader::openStream() {
+    // 새 스트림을 먼저 끊어야 이전 압축 해제 스레드를 안전하게 정리할 수 있음
+    input_.reset();
+    decodeBuffer_.reset();
+    
+    switch (compression_) {
+        case Compression::Gzip:
+            decodeBuffer_ = createGzipStreamBuf(filePath_);
+            break;
+        case Compression::Zstd:
+            decodeBuffer_ = createZstdStreamBuf(filePath_);
+            break;
+        case Compression::None: {
+            if (mode_ == ReadMode::AsyncRead) {
+                auto backend = isIoUringAvailable() ? AsyncReadBackend::IoUring : AsyncReadBackend::PreadThread;
+                decodeBuffer_ = createAsyncReadStreamBuf(filePath_, backend);
+                break;
+            }
+            auto file = std::make_unique<std::ifstream>(filePath_);
+            if (!file->is_open()) {
+                return false;
+            }
+            input_ = std::move(file);
+            return true;
+        }
+    }
+    
+    if (!decodeBuffer_) {
+        return false;
+    }
+    input_ = std::make_unique<std::istream>(decodeBuffer_.get());
+    return true;
 }
 
 void LogFileReader::validateFile() {
@@ -45,36 +311,623 @@ std::vector<std::string> LogFileReader::readAllLines() {
         return lines;
     }
     
-    // 파일 스트림 재설정
-    fileStream_.clear();
-    fileStream_.seekg(0, std::ios::beg);
+    if (mode_ == ReadMode::MemoryMapped) {
+        mappedPos_ = 0;
+        resetLineScan();
+        restartIndexScan();
+        while (auto view = nextMappedLine()) {
+            lines.emplace_back(*view);
+        }
+        return lines;
+    }
+    
+    // 파일 스트림 재설정 (압축 입력은 처음부터 다시 풀어야 함, 표준 입력은 남은 라인만 읽음)
+    if (isStandardInput()) {
+        input_->clear();
+    } else if (compression_ != Compression::None || mode_ == ReadMode::AsyncRead) {
+        if (!openStream()) {
+            return lines;
+        }
+        resetLineScan();
+        streamBytesRead_ = 0;
+    } else {
+        input_->clear();
+        input_->seekg(0, std::ios::beg);
+        resetLineScan();
+        streamBytesRead_ = 0;
+    }
+    restartIndexScan();
     
-    std::string line;
-    while (std::getline(fileStream_, line)) {
-        lines.emplace_back(std::move(line));
+    while (auto view = nextStreamLine()) {
+        lines.emplace_back(*view);
     }
     
     return lines;
 }
 
 std::optional<std::string> LogFileReader::readNextLine() {
-    if (!isValid_ || !fileStream_.is_open()) {
+    if (!isValid_) {
         return std::nullopt;
     }
     
-    std::string line;
-    if (std::getline(fileStream_, line)) {
-        return line;
+    if (mode_ == ReadMode::MemoryMapped) {
+        if (auto view = nextMappedLine()) {
+            return std::string(*view);
+        }
+        return std::nullopt;
+    }
+    
+    if (auto view = nextStreamLine()) {
+        return std::string(*view);
     }
     
     return std::nullopt;
 }
 
+std::optional<std::string_view> LogFileReader::readNextLineView() {
+    if (!isValid_) {
+        return std::nullopt;
+    }
+    
+    if (mode_ == ReadMode::MemoryMapped) {
+        return nextMappedLine();
+    }
+    
+    return nextStreamLine();
+}
+
+std::size_t LogFileReader::readLines(LineBatch& batch, std::size_t maxLines) {
+    batch.clear();
+    
+    while (batch.size() < maxLines) {
+        auto line = readNextLineView();
+        if (!line) {
+            break;
+        }
+        batch.append(*line);
+    }
+    
+    return batch.size();
+}
+
+std::vector<std::string_view> LogFileReader::readAllLineViews() {
+    std::vector<std::string_view> views;
+    
+    if (!isValid_ || mode_ != ReadMode::MemoryMapped) {
+        return views;
+    }
+    
+    mappedPos_ = 0;
+    resetLineScan();
+    restartIndexScan();
+    while (auto view = nextMappedLine()) {
+        views.push_back(*view);
+    }
+    
+    return views;
+}
+
+std::optional<std::string_view> LogFileReader::nextMappedLine() {
+    std::string_view data = mappedFile_.data();
+    if (mappedPos_ >= data.size()) {
+        finishIndexScan();
+        return std::nullopt;
+    }
+    
+    // 찾아 둔 개행을 다 쓰면 다음 범위를 한꺼번에 훑음
+    while (nextNewline_ == newlineOffsets_.size() && mappedScanPos_ < data.size()) {
+        newlineOffsets_.clear();
+        nextNewline_ = 0;
+        std::size_t scanEnd = std::min(mappedScanPos_ + MAPPED_SCAN_WINDOW, data.size());
+        findNewlines(data.data() + mappedScanPos_, scanEnd - mappedScanPos_, mappedScanPos_, newlineOffsets_);
+        mappedScanPos_ = scanEnd;
+    }
+    
+    const char* begin = data.data() + mappedPos_;
+    
+    // std::getline 과 동일한 규칙: 마지막 줄은 개행이 없어도 한 라인
+    if (nextNewline_ == newlineOffsets_.size()) {
+        std::size_t remaining = data.size() - mappedPos_;
+        mappedPos_ = data.size();
+        lastLineTerminated_ = false;
+        recordScannedLine();
+        return stripCarriageReturn(std::string_view(begin, remaining));
+    }
+    
+    std::size_t newline = newlineOffsets_[nextNewline_++];
+    std::size_t length = newline - mappedPos_;
+    mappedPos_ = newline + 1;
+    lastLineTerminated_ = true;
+    recordScannedLine();
+    return stripCarriageReturn(std::string_view(begin, length));
+}
+
+std::optional<std::string_view> LogFileReader::nextStreamLine() {
+    if (!input_) {
+        return std::nullopt;
+    }
+    
+    for (;;) {
+        if (nextNewline_ < newlineOffsets_.size()) {
+            std::size_t newline = newlineOffsets_[nextNewline_++];
+            std::string_view line(readBuffer_.data() + bufferBegin_, newline - bufferBegin_);
+            bufferBegin_ = newline + 1;
+            lastLineTerminated_ = true;
+            streamBytesRead_ += line.size() + 1;
+            recordScannedLine();
+            return stripCarriageReturn(line);
+        }
+        
+        if (!fillReadBuffer()) {
+            break;
+        }
+    }
+    
+    // std::getline 과 동일한 규칙: 마지막 줄은 개행이 없어도 한 라인
+    if (bufferBegin_ == bufferEnd_) {
+        finishIndexScan();
+        return std::nullopt;
+    }
+    std::string_view line(readBuffer_.data() + bufferBegin_, bufferEnd_ - bufferBegin_);
+    bufferBegin_ = bufferEnd_;
+    lastLineTerminated_ = false;
+    streamBytesRead_ += line.size();
+    recordScannedLine();
+    return stripCarriageReturn(line);
+}
+
+bool LogFileReader::fillReadBuffer() {
+    // 남은 조각에는 개행이 없으므로 앞으로 옮기고 새로 읽은 바이트만 훑음
+    std::size_t remaining = bufferEnd_ - bufferBegin_;
+    if (bufferBegin_ > 0 && remaining > 0) {
+        std::memmove(readBuffer_.data(), readBuffer_.data() + bufferBegin_, remaining);
+    }
+    bufferBegin_ = 0;
+    bufferEnd_ = remaining;
+    
+    if (readBuffer_.size() < STREAM_READ_BLOCK_SIZE) {
+        readBuffer_.resize(STREAM_READ_BLOCK_SIZE);
+    } else if (remaining == readBuffer_.size()) {
+        readBuffer_.resize(readBuffer_.size() * 2); // 블록보다 긴 라인
+    }
+    
+    newlineOffsets_.clear();
+    nextNewline_ = 0;
+    
+    // EOF 이후에도 다시 호출하면 그 사이 파일에 추가된 바이트를 읽음 (follow 모드)
+    std::streamsize n = input_->rdbuf()->sgetn(readBuffer_.data() + bufferEnd_,
+                                               static_cast<std::streamsize>(readBuffer_.size() - bufferEnd_));
+    if (n <= 0) {
+        return false;
+    }
+    
+    findNewlines(readBuffer_.data() + bufferEnd_, static_cast<std::size_t>(n), bufferEnd_, newlineOffsets_);
+    bufferEnd_ += static_cast<std::size_t>(n);
+    return true;
+}
+
+void LogFileReader::resetLineScan() noexcept {
+    mappedScanPos_ = mappedPos_;
+    bufferBegin_ = 0;
+    bufferEnd_ = 0;
+    newlineOffsets_.clear();
+    nextNewline_ = 0;
+}
+
+void LogFileReader::restartIndexScan() {
+    scanSamples_.clear();
+    scanLineCount_ = 0;
+    scanTracking_ = isValid_ && compression_ == Compression::None && !isStandardInput();
+}
+
+void LogFileReader::recordScannedLine() {
+    if (!scanTracking_) {
+        return;
+    }
+    
+    // LineIndex::build 와 같은 규칙: sampleInterval 번째 라인마다 다음 라인의 시작 위치
+    ++scanLineCount_;
+    if (lastLineTerminated_ && scanLineCount_ % LineIndex::DEFAULT_SAMPLE_INTERVAL == 0) {
+        scanSamples_.push_back(getReadOffset());
+    }
+}
+
+void LogFileReader::finishIndexScan() {
+    if (!scanTracking_) {
+        return;
+    }
+    // EOF 이후 추가되는 라인은 ensureLineIndex 가 이어서 인덱싱
+    scanTracking_ = false;
+    
+    std::uintmax_t scannedSize = getReadOffset();
+    if (!scanSamples_.empty() && scanSamples_.back() >= scannedSize) {
+        scanSamples_.pop_back();
+    }
+    std::vector<std::uintmax_t> sampleOffsets;
+    sampleOffsets.reserve(scanSamples_.size() + 1);
+    if (scannedSize > 0) {
+        sampleOffsets.push_back(0);
+    }
+    sampleOffsets.insert(sampleOffsets.end(), scanSamples_.begin(), scanSamples_.end());
+    scanSamples_ = std::vector<std::uintmax_t>();
+    
+    // 메모리에만 두고 sidecar 는 라인 범위 읽기를 요청받았을 때 저장 (일반 분석은 로그 디렉터리에 파일을 만들지 않음)
+    lineIndex_ = LineIndex::fromScan(filePath_, LineIndex::DEFAULT_SAMPLE_INTERVAL, scanLineCount_,
+                                     std::move(sampleOffsets), scannedSize);
+    lineIndexSaved_ = false;
+}
+
+bool LogFileReader::isLastLineTerminated() const noexcept {
+    return lastLineTerminated_;
+}
+
+void LogFileReader::resumeAfterEof() {
+    if (mode_ == ReadMode::Stream && input_) {
+        // 실패/EOF 상태만 지우면 다음 읽기가 파일에서 다시 읽기를 시도함
+        input_->clear();
+    }
+}
+
+bool LogFileReader::seekTo(std::uintmax_t offset) {
+    if (!isValid_ || compression_ != Compression::None || isStandardInput() || mode_ == ReadMode::AsyncRead) {
+        return false;
+    }
+    
+    if (mode_ == ReadMode::MemoryMapped) {
+        if (offset > mappedFile_.size()) {
+            return false;
+        }
+        mappedPos_ = static_cast<std::size_t>(offset);
+        resetLineScan();
+        if (offset == 0) {
+            restartIndexScan();
+        } else {
+            scanTracking_ = false;
+        }
+        return true;
+    }
+    
+    input_->clear();
+    if (!input_->seekg(static_cast<std::streamoff>(offset), std::ios::beg)) {
+        return false;
+    }
+    resetLineScan();
+    streamBytesRead_ = offset;
+    if (offset == 0) {
+        restartIndexScan();
+    } else {
+        scanTracking_ = false;
+    }
+    return true;
+}
+
+std::uintmax_t LogFileReader::getReadOffset() const noexcept {
+    return mode_ == ReadMode::MemoryMapped ? mappedPos_ : streamBytesRead_;
+}
+
+std::vector<FileChunk> LogFileReader::splitIntoChunks(std::size_t chunkCount, ThreadPool& pool) const {
+    std::vector<FileChunk> chunks;
+    
+    if (!isValid_) {
+        return chunks;
+    }
+    
+    if (compression_ != Compression::None || isStandardInput()) {
+        std::cerr << "압축 파일과 표준 입력은 구간 분할을 지원하지 않습니다: " << filePath_ << std::endl;
+        return chunks;
+    }
+    
+    std::uintmax_t fileSize = getFileSize();
+    if (fileSize == 0) {
+        return chunks;
+    }
+    
+    ScopedFd fd(filePath_);
+    if (!fd.isOpen()) {
+        std::cerr << "구간 분할 실패: " << filePath_ << " (" << std::strerror(errno) << ")" << std::endl;
+        return chunks;
+    }
+    
+    // 균등 분할 지점을 다음 라인 시작으로 밀어서 경계를 정함
+    // 긴 라인이 여러 분할 지점을 덮으면 중복 경계는 하나로 합쳐짐
+    chunkCount = std::max<std::size_t>(chunkCount, 1);
+    std::vector<std::uintmax_t> boundaries{0};
+    for (std::size_t i = 1; i < chunkCount; ++i) {
+        std::uintmax_t target = fileSize / chunkCount * i + fileSize % chunkCount * i / chunkCount;
+        std::uintmax_t boundary = alignToLineStart(fd.get(), target, fileSize);
+        if (boundary > boundaries.back() && boundary < fileSize) {
+            boundaries.push_back(boundary);
+        }
+    }
+    boundaries.push_back(fileSize);
+    
+    for (std::size_t i = 0; i + 1 < boundaries.size(); ++i) {
+        FileChunk chunk;
+        chunk.offset = boundaries[i];
+        chunk.length = boundaries[i + 1] - boundaries[i];
+        chunks.push_back(chunk);
+    }
+    
+    // 구간별 라인 수를 병렬로 계산 (pread 는 위치를 공유하지 않으므로 디스크립터 하나를 함께 씀)
+    std::vector<char> counted(chunks.size(), 0);
+    pool.run(chunks.size(), [&](std::size_t i) {
+        auto lineCount = countNewlines(fd.get(), chunks[i].offset, chunks[i].length);
+        if (lineCount) {
+            chunks[i].lineCount = *lineCount;
+            counted[i] = 1;
+        }
+    });
+    if (std::find(counted.begin(), counted.end(), 0) != counted.end()) {
+        std::cerr << "구간 라인 수 계산 실패: " << filePath_ << " (파일을 끝까지 읽지 못했습니다)" << std::endl;
+        return {};
+    }
+    
+    // 마지막 구간만 개행 없이 끝날 수 있음 (std::getline 과 동일하게 한 라인으로 셈)
+    FileChunk& last = chunks.back();
+    char lastByte = '\n';
+    if (preadFully(fd.get(), &lastByte, 1, fileSize - 1) == 1 && lastByte != '\n') {
+        ++last.lineCount;
+    }
+    
+    // 라인 번호 prefix sum
+    std::size_t nextLineNumber = 1;
+    for (auto& chunk : chunks) {
+        chunk.firstLineNumber = nextLineNumber;
+        nextLineNumber += chunk.lineCount;
+    }
+    
+    return chunks;
+}
+
+std::vector<FileChunk> LogFileReader::sampleBlocks(double fraction, std::uint64_t seed, std::size_t blockSize) const {
+    std::vector<FileChunk> chunks;
+    
+    if (!isValid_) {
+        return chunks;
+    }
+    
+    if (compression_ != Compression::None || isStandardInput()) {
+        std::cerr << "압축 파일과 표준 입력은 표본 분석을 지원하지 않습니다: " << filePath_ << std::endl;
+        return chunks;
+    }
+    
+    std::uintmax_t fileSize = getFileSize();
+    if (fileSize == 0 || fraction <= 0.0) {
+        return chunks;
+    }
+    
+    ScopedFd fd(filePath_);
+    if (!fd.isOpen()) {
+        std::cerr << "표본 블록 선택 실패: " << filePath_ << " (" << std::strerror(errno) << ")" << std::endl;
+        return chunks;
+    }
+    
+    blockSize = std::max<std::size_t>(blockSize, 1);
+    std::size_t blockCount = static_cast<std::size_t>((fileSize + blockSize - 1) / blockSize);
+    std::size_t sampleCount = std::clamp<std::size_t>(
+        static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(blockCount))), 1, blockCount);
+    
+    // 비복원 추출 (std::sample 은 입력 순서를 유지하므로 결과가 오프셋 순)
+    std::vector<std::size_t> allBlocks(blockCount);
+    std::iota(allBlocks.begin(), allBlocks.end(), 0);
+    std::vector<std::size_t> picked;
+    picked.reserve(sampleCount);
+    std::sample(allBlocks.begin(), allBlocks.end(), std::back_inserter(picked), sampleCount, std::mt19937_64(seed));
+    
+    for (std::size_t block : picked) {
+        std::uintmax_t start = alignToLineStart(fd.get(), static_cast<std::uintmax_t>(block) * blockSize, fileSize);
+        std::uintmax_t end = alignToLineStart(fd.get(), std::min<std::uintmax_t>(static_cast<std::uintmax_t>(block + 1) * blockSize, fileSize), fileSize);
+        // 블록보다 긴 라인이 블록 전체를 덮으면 이 블록에서 시작하는 라인이 없음
+        if (end > start) {
+            FileChunk chunk;
+            chunk.offset = start;
+            chunk.length = end - start;
+            chunks.push_back(chunk);
+        }
+    }
+    
+    return chunks;
+}
+
+void LogFileReader::forEachLineInChunk(const FileChunk& chunk,
+                                       const std::function<void(std::string_view line, std::size_t lineNumber)>& callback) const {
+    if (!isValid_ || chunk.length == 0 || compression_ != Compression::None || isStandardInput()) {
+        return;
+    }
+    
+    ScopedFd fd(filePath_);
+    if (!fd.isOpen()) {
+        std::cerr << "구간 읽기 실패: " << filePath_ << " (" << std::strerror(errno) << ")" << std::endl;
+        return;
+    }
+    
+    forEachLineFrom(fd.get(), chunk.offset, chunk.length, chunk.firstLineNumber,
+                    [&callback](std::string_view line, std::size_t lineNumber) {
+        callback(stripCarriageReturn(line), lineNumber);
+        return true;
+    });
+}
+
+void LogFileReader::forEachLineReverse(const std::function<bool(std::string_view line)>& callback,
+                                       std::size_t blockSize) const {
+    if (!isValid_ || compression_ != Compression::None || isStandardInput()) {
+        return;
+    }
+    
+    ScopedFd fd(filePath_);
+    if (!fd.isOpen()) {
+        std::cerr << "역방향 읽기 실패: " << filePath_ << " (" << std::strerror(errno) << ")" << std::endl;
+        return;
+    }
+    
+    std::uintmax_t fileSize = getFileSize();
+    std::uintmax_t end = fileSize;
+    std::vector<char> block(std::max<std::size_t>(blockSize, 1));
+    std::string tail; // 앞쪽 블록에서 시작하는 라인의 뒷부분 (블록 경계에 걸친 라인)
+    bool skipFinalNewline = true; // 파일 끝 개행 뒤의 빈 라인은 라인이 아님
+    
+    while (end > 0) {
+        std::size_t toRead = static_cast<std::size_t>(std::min<std::uintmax_t>(block.size(), end));
+        std::uintmax_t begin = end - toRead;
+        if (preadFully(fd.get(), block.data(), toRead, begin) != static_cast<ssize_t>(toRead)) {
+            std::cerr << "역방향 읽기 실패: " << filePath_ << std::endl;
+            return;
+        }
+        end = begin;
+        
+        std::size_t lineEnd = toRead;
+        if (skipFinalNewline) {
+            skipFinalNewline = false;
+            if (block[toRead - 1] == '\n') {
+                --lineEnd;
+            }
+        }
+        
+        // 블록 안의 개행을 뒤에서부터 찾아 그 뒤의 라인을 내보냄
+        while (const void* found = ::memrchr(block.data(), '\n', lineEnd)) {
+            std::size_t newline = static_cast<std::size_t>(static_cast<const char*>(found) - block.data());
+            bool keepGoing;
+            if (tail.empty()) {
+                keepGoing = callback(stripCarriageReturn(std::string_view(block.data() + newline + 1, lineEnd - newline - 1)));
+            } else {
+                tail.insert(0, block.data() + newline + 1, lineEnd - newline - 1);
+                keepGoing = callback(stripCarriageReturn(tail));
+                tail.clear();
+            }
+            if (!keepGoing) {
+                return;
+            }
+            lineEnd = newline;
+        }
+        tail.insert(0, block.data(), lineEnd);
+    }
+    
+    // 파일 첫 라인 (비어 있는 첫 라인일 수도 있음)
+    if (fileSize > 0) {
+        callback(stripCarriageReturn(tail));
+    }
+}
+
+std::vector<std::string> LogFileReader::readLastLines(std::size_t count) const {
+    std::vector<std::string> lines;
+    if (count == 0) {
+        return lines;
+    }
+    
+    forEachLineReverse([&lines, count](std::string_view line) {
+        lines.emplace_back(line);
+        return lines.size() < count;
+    });
+    std::reverse(lines.begin(), lines.end());
+    return lines;
+}
+
+std::vector<std::string> LogFileReader::readChunkLines(const FileChunk& chunk) const {
+    std::vector<std::string> lines;
+    lines.reserve(chunk.lineCount);
+    
+    forEachLineInChunk(chunk, [&lines](std::string_view line, std::size_t) {
+        lines.emplace_back(line);
+    });
+    
+    return lines;
+}
+
+std::size_t LogFileReader::readChunkLines(const FileChunk& chunk, LineBatch& batch) const {
+    batch.clear();
+    batch.reserve(static_cast<std::size_t>(chunk.length), chunk.lineCount);
+    
+    forEachLineInChunk(chunk, [&batch](std::string_view line, std::size_t) {
+        batch.append(line);
+    });
+    
+    return batch.size();
+}
+
+FileChunk LogFileReader::findTimeRange(const std::string& since, const std::string& until) const {
+    FileChunk range;
+    
+    if (!isValid_ || compression_ != Compression::None || isStandardInput()) {
+        return range;
+    }
+    
+    std::uintmax_t fileSize = getFileSize();
+    ScopedFd fd(filePath_);
+    if (!fd.isOpen()) {
+        std::cerr << "시간 범위 탐색 실패: " << filePath_ << " (" << std::strerror(errno) << ")" << std::endl;
+        return range;
+    }
+    
+    LogParser parser;
+    std::uintmax_t begin = since.empty() ? 0 : lowerBoundByTimestamp(fd.get(), fileSize, parser, since);
+    std::uintmax_t end = until.empty() ? fileSize : lowerBoundByTimestamp(fd.get(), fileSize, parser, until);
+    
+    range.offset = begin;
+    range.length = end > begin ? end - begin : 0;
+    return range;
+}
+
+const LineIndex* LogFileReader::ensureLineIndex() {
+    if (!isValid_ || compression_ != Compression::None || isStandardInput()) {
+        return nullptr;
+    }
+    
+    // 캐시한 인덱스(순차 읽기로 만든 것 포함)는 파일이 뒤로 커지기만 했으면 이어서 인덱싱
+    if (!lineIndex_ || lineIndex_->getFileSize() != getFileSize()) {
+        if (lineIndex_ && lineIndex_->extend()) {
+            lineIndexSaved_ = false;
+        } else {
+            lineIndex_ = LineIndex::loadOrBuild(filePath_);
+            lineIndexSaved_ = true;
+        }
+    }
+    if (lineIndex_ && !lineIndexSaved_) {
+        lineIndexSaved_ = lineIndex_->save();
+    }
+    return lineIndex_ ? &*lineIndex_ : nullptr;
+}
+
+std::vector<std::string> LogFileReader::readLineRange(std::size_t firstLine, std::size_t count) {
+    std::vector<std::string> lines;
+    
+    const LineIndex* index = ensureLineIndex();
+    if (index == nullptr || count == 0 || firstLine == 0 || firstLine > index->getLineCount()) {
+        return lines;
+    }
+    
+    ScopedFd fd(filePath_);
+    if (!fd.isOpen()) {
+        std::cerr << "라인 범위 읽기 실패: " << filePath_ << " (" << std::strerror(errno) << ")" << std::endl;
+        return lines;
+    }
+    
+    auto [sampleLine, sampleOffset] = index->nearestSample(firstLine);
+    lines.reserve(std::min(count, index->getLineCount() - firstLine + 1));
+    forEachLineFrom(fd.get(), sampleOffset, index->getFileSize() - sampleOffset, sampleLine,
+                    [&](std::string_view line, std::size_t lineNumber) {
+        if (lineNumber >= firstLine) {
+            lines.emplace_back(stripCarriageReturn(line));
+        }
+        return lines.size() < count;
+    });
+    
+    return lines;
+}
+
+std::size_t LogFileReader::getLineCount() {
+    const LineIndex* index = ensureLineIndex();
+    return index != nullptr ? index->getLineCount() : 0;
+}
+
 std::uintmax_t LogFileReader::getFileSize() const {
     if (!isValid_) {
         return 0;
     }
     
+    if (isStandardInput()) {
+        return streamBytesRead_;
+    }
+    
     try {
         return std::filesystem::file_size(filePath_);
     } catch (const std::filesystem::filesystem_error& e) {
@@ -87,4 +940,24 @@ std::string LogFileReader::getFilePath() const noexcept {
     return filePath_;
 }
 
+ReadMode LogFileReader::getReadMode() const noexcept {
+    return mode_;
+}
+
+Compression LogFileReader::getCompression() const noexcept {
+    return compression_;
+}
+
+bool LogFileReader::isStandardInput() const noexcept {
+    return filePath_ == STDIN_PATH;
+}
+
+bool LogFileReader::hasReadError() const noexcept {
+    return decodeBuffer_ && decodeBuffer_->hasReadError();
+}
+
+bool LogFileReader::isCompressed() const noexcept {
+    return compression_ != Compression::None;
+}
+
 } // namespace LogAnalyzer 
\ No newline at end of file
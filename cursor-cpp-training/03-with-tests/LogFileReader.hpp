@@ -1,16 +1,53 @@
 #pragma once
 
+#include "MappedFile.hpp"
+#include "CompressedInput.hpp"
+#include "AsyncFileInput.hpp"
+#include "LineIndex.hpp"
+#include "LineBatch.hpp"
+#include "LogParser.hpp"
+#include "ThreadPool.hpp"
 #include <string>
+#include <string_view>
 #include <vector>
-#include <fstream>
+#include <istream>
+#include <memory>
 #include <optional>
 #include <filesystem>
+#include <functional>
 
 namespace LogAnalyzer {
 
+// 파일 읽기 방식
+enum class ReadMode {
+    Stream,         // std::ifstream 기반 순차 읽기
+    MemoryMapped,   // mmap 기반, 라인을 매핑 영역의 string_view 로 노출
+    AsyncRead       // io_uring(또는 pread 읽기 스레드)으로 여러 블록을 미리 읽으며 순차 읽기
+};
+
+// 병렬 처리용 파일 구간 (라인 경계에 정렬됨)
+struct FileChunk {
+    std::uintmax_t offset = 0;       // 구간 시작 바이트 오프셋
+    std::uintmax_t length = 0;       // 구간 바이트 길이
+    std::size_t firstLineNumber = 1; // 구간 첫 라인의 파일 내 라인 번호 (1부터 시작)
+    std::size_t lineCount = 0;       // 구간에 포함된 라인 수
+};
+
+// gzip/zstd 입력은 매직 바이트로 자동 판별되어 백그라운드 스레드에서 풀리며
+// 라인 API 는 압축 여부와 관계없이 동일하게 동작 (구간 분할은 비압축 파일 전용)
+// 경로가 "-" 이면 표준 입력(파이프)을 큰 버퍼로 순차 읽기만 함 (되감기/구간 분할 불가)
 class LogFileReader {
 public:
-    explicit LogFileReader(const std::string& filePath);
+    // 표준 입력을 가리키는 경로
+    static constexpr const char* STDIN_PATH = "-";
+    
+    // 역방향 읽기 시 파일 끝에서부터 한 번에 읽는 블록 크기
+    static constexpr std::size_t REVERSE_READ_BLOCK_SIZE = 1 << 20;
+    
+    // 표본 분석 시 파일을 나누는 블록 크기
+    static constexpr std::size_t SAMPLE_BLOCK_SIZE = 256 * 1024;
+    
+    explicit LogFileReader(const std::string& filePath, ReadMode mode = ReadMode::Stream);
     ~LogFileReader() = default;
 
     // 복사 생성자와 대입 연산자 삭제 (RAII 패턴)
@@ -30,16 +67,124 @@ public:
     // 라인별 순차 읽기 (메모리 효율적)
     std::optional<std::string> readNextLine();
     
-    // 파일 정보
+    // 라인 API 는 CRLF 줄 끝의 '\r' 을 떼고 넘기며 읽기 위치는 원본 바이트 기준
+    // 개행은 읽기 블록 전체를 SIMD 로 한 번에 찾아 두고 라인마다 꺼내 씀
+    
+    // 라인별 순차 읽기 (할당 없음)
+    // MemoryMapped 모드: 매핑 영역을 가리키며 reader 가 살아있는 동안 유효
+    // Stream/AsyncRead 모드: 내부 버퍼를 가리키며 다음 읽기 호출 전까지만 유효
+    std::optional<std::string_view> readNextLineView();
+    
+    // 최대 maxLines 개의 라인을 batch 에 채움 (batch 의 기존 내용은 지우고 용량은 재사용)
+    // 읽은 라인 수를 반환하며 0 이면 EOF
+    std::size_t readLines(LineBatch& batch, std::size_t maxLines);
+    
+    // 전체 라인을 뷰로 읽기 (MemoryMapped 모드에서만 라인 복사 없음)
+    std::vector<std::string_view> readAllLineViews();
+    
+    // 마지막으로 읽은 라인이 개행으로 끝났는지 (false 면 EOF 에서 잘린, 아직 쓰는 중인 라인)
+    bool isLastLineTerminated() const noexcept;
+    
+    // EOF 이후 파일에 추가된 내용을 이어서 읽을 수 있도록 스트림 상태 복구 (Stream 모드)
+    void resumeAfterEof();
+    
+    // 다음 라인 읽기를 offset 바이트부터 시작 (offset 은 라인 시작이어야 함)
+    // 비압축 파일의 Stream/MemoryMapped 모드 전용, 실패 시 false
+    bool seekTo(std::uintmax_t offset);
+    
+    // 라인 읽기로 소비한 위치 (파일 처음 기준 바이트 오프셋)
+    std::uintmax_t getReadOffset() const noexcept;
+    
+    // 파일을 최대 chunkCount 개의 라인 경계 구간으로 분할
+    // 구간별 라인 수는 pool 에서 병렬로 세고 prefix sum 으로 firstLineNumber 를 채움
+    // 어느 구간이든 끝까지 읽지 못하면 라인 번호가 어긋나므로 빈 목록을 반환
+    std::vector<FileChunk> splitIntoChunks(std::size_t chunkCount, ThreadPool& pool = ThreadPool::shared()) const;
+    
+    // 파일을 blockSize 블록으로 나눠 fraction 비율만큼 무작위로 고른 블록을 라인 경계에 맞춘 구간 (비압축 파일 전용)
+    // 블록 안에서 시작하는 라인이 그 블록에 속하므로 모든 블록을 고르면 파일 전체와 같음
+    // 구간은 오프셋 순이며 firstLineNumber/lineCount 는 채우지 않음
+    std::vector<FileChunk> sampleBlocks(double fraction, std::uint64_t seed,
+                                        std::size_t blockSize = SAMPLE_BLOCK_SIZE) const;
+    
+    // 구간 내 라인 순회 (호출마다 독립된 파일 핸들을 사용하므로 여러 스레드에서 동시 호출 가능)
+    // 콜백의 line 뷰는 콜백 안에서만 유효
+    void forEachLineInChunk(const FileChunk& chunk,
+                            const std::function<void(std::string_view line, std::size_t lineNumber)>& callback) const;
+    
+    // 파일 끝에서부터 라인을 최신순으로 순회 (콜백이 false 를 반환하면 중단, 비압축 파일 전용)
+    // 큰 블록 단위로 뒤에서부터 pread 하므로 일찍 멈추면 읽은 블록만큼만 I/O 가 발생
+    // 콜백의 line 뷰는 콜백 안에서만 유효
+    void forEachLineReverse(const std::function<bool(std::string_view line)>& callback,
+                            std::size_t blockSize = REVERSE_READ_BLOCK_SIZE) const;
+    
+    // 마지막 count 개 라인 (파일 순서대로)
+    std::vector<std::string> readLastLines(std::size_t count) const;
+    
+    // 구간 내 전체 라인 읽기
+    std::vector<std::string> readChunkLines(const FileChunk& chunk) const;
+    
+    // 구간 내 전체 라인을 batch 하나의 연속 버퍼에 읽기 (batch 의 기존 내용은 지움), 읽은 라인 수를 반환
+    std::size_t readChunkLines(const FileChunk& chunk, LineBatch& batch) const;
+    
+    // firstLine(1부터) 부터 최대 count 개 라인 읽기 (비압축 파일 전용)
+    // 처음 호출 시 .lidx sidecar 를 읽거나 만들어 두고, 가장 가까운 표본 오프셋에서 pread 로 읽기 시작
+    // 이미 처음부터 끝까지 순차로 읽었다면 그때 메모리에 모아 둔 표본을 쓰므로 파일을 다시 훑지 않음 (sidecar 는 이때 저장)
+    std::vector<std::string> readLineRange(std::size_t firstLine, std::size_t count);
+    
+    // 타임스탬프가 [since, until) 인 라인이 들어 있는 바이트 구간 (비압축 파일 전용)
+    // 시간순으로 기록된 파일을 바이트 오프셋으로 이분 탐색하므로 파일 크기와 무관하게 수십 번의 pread 로 끝남
+    // since/until 은 "YYYY-MM-DD HH:MM:SS" 또는 그 앞부분이며 비어 있으면 각각 파일 처음/끝
+    // 타임스탬프 없는 라인은 앞 라인에 딸린 것으로 보며, 반환 구간의 firstLineNumber/lineCount 는 채우지 않음
+    FileChunk findTimeRange(const std::string& since, const std::string& until) const;
+    
+    // 전체 라인 수 (라인 인덱스 기준, 비압축 파일 전용)
+    std::size_t getLineCount();
+    
+    // 파일 정보 (표준 입력은 전체 크기를 알 수 없으므로 지금까지 읽은 바이트 수)
     std::uintmax_t getFileSize() const;
     std::string getFilePath() const noexcept;
+    ReadMode getReadMode() const noexcept;
+    Compression getCompression() const noexcept;
+    bool isCompressed() const noexcept;
+    bool isStandardInput() const noexcept;
+    
+    // 순차 읽기가 입력 손상이나 I/O 오류로 끝났는지 (라인 API 는 이때도 EOF 처럼 끝나므로 다 읽은 뒤 확인)
+    // 압축 해제/비동기 읽기/표준 입력에서만 감지되며 평문 Stream/MemoryMapped 모드는 항상 false
+    bool hasReadError() const noexcept;
 
 private:
     std::string filePath_;
-    std::ifstream fileStream_;
+    ReadMode mode_;
+    Compression compression_;
+    std::unique_ptr<InputStreamBuf> decodeBuffer_;  // 압축/비동기/표준 입력일 때 input_ 이 읽는 버퍼
+    std::unique_ptr<std::istream> input_;
+    MappedFile mappedFile_;
+    std::size_t mappedPos_;
+    std::size_t mappedScanPos_;              // 개행을 찾아 둔 매핑 영역의 끝
+    std::vector<char> readBuffer_;           // 스트림에서 블록 단위로 읽어 둔 바이트
+    std::size_t bufferBegin_;                // readBuffer_ 에서 다음 라인 시작
+    std::size_t bufferEnd_;                  // readBuffer_ 의 유효 바이트 끝
+    std::vector<std::size_t> newlineOffsets_; // 한 번에 찾아 둔 개행 위치 (readBuffer_ 또는 매핑 영역 기준)
+    std::size_t nextNewline_;                // newlineOffsets_ 에서 다음에 쓸 항목
+    std::optional<LineIndex> lineIndex_;
+    bool lineIndexSaved_;                     // lineIndex_ 가 sidecar 와 같은지 (순차 읽기로 만든 인덱스는 false)
+    std::vector<std::uintmax_t> scanSamples_; // 처음부터 순차로 읽는 동안 모으는 라인 인덱스 표본
+    std::size_t scanLineCount_;
+    bool scanTracking_;                       // 탐색했거나 압축/표준 입력이면 false
+    std::uintmax_t streamBytesRead_;  // 스트림 방식으로 읽을 때 라인으로 소비한 바이트 수
+    bool lastLineTerminated_;
     bool isValid_;
     
     void validateFile();
+    bool openStream();
+    const LineIndex* ensureLineIndex();
+    std::optional<std::string_view> nextMappedLine();
+    std::optional<std::string_view> nextStreamLine();
+    bool fillReadBuffer();
+    void resetLineScan() noexcept;
+    void restartIndexScan();
+    void recordScannedLine();
+    void finishIndexScan();
 };
 
 } // namespace LogAnalyzer 
\ No newline at end of file
@@ -0,0 +1,243 @@
+#include "LogFollower.hpp"
+#include "PosixFile.hpp"
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <filesystem>
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+
+namespace LogAnalyzer {
+
+LogFollower::LogFollower(const std::string& filePath)
+    : filePath_(filePath), reader_(filePath), readOffset_(0), device_(0), inode_(0),
+      rotationCount_(0), inotifyFd_(-1), fileWatch_(-1), directoryWatch_(-1) {
+    if (!reader_.isValid()) {
+        return;
+    }
+
+    struct stat st {};
+    if (::stat(filePath_.c_str(), &st) == 0) {
+        device_ = st.st_dev;
+        inode_ = st.st_ino;
+    }
+    setupWatch();
+}
+
+LogFollower::~LogFollower() {
+    if (inotifyFd_ >= 0) {
+        ::close(inotifyFd_);
+    }
+}
+
+void LogFollower::setupWatch() {
+#ifdef __linux__
+    inotifyFd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd_ < 0) {
+        std::cerr << "inotify 초기화 실패, 폴링으로 대체합니다: " << std::strerror(errno) << std::endl;
+        return;
+    }
+
+    // rename 후 같은 경로에 새 파일이 생기는 것은 디렉터리 감시로만 알 수 있음
+    std::string directory = std::filesystem::path(filePath_).parent_path().string();
+    if (directory.empty()) {
+        directory = ".";
+    }
+    directoryWatch_ = ::inotify_add_watch(inotifyFd_, directory.c_str(), IN_CREATE | IN_MOVED_TO);
+
+    watchCurrentFile();
+    if (fileWatch_ < 0) {
+        std::cerr << "inotify 감시 등록 실패, 폴링으로 대체합니다: " << std::strerror(errno) << std::endl;
+        ::close(inotifyFd_);
+        inotifyFd_ = -1;
+    }
+#endif
+}
+
+void LogFollower::watchCurrentFile() {
+#ifdef __linux__
+    if (inotifyFd_ < 0) {
+        return;
+    }
+
+    if (fileWatch_ >= 0) {
+        ::inotify_rm_watch(inotifyFd_, fileWatch_);
+    }
+    fileWatch_ = ::inotify_add_watch(inotifyFd_, filePath_.c_str(),
+                                     IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_MOVE_SELF | IN_DELETE_SELF);
+#endif
+}
+
+void LogFollower::openCurrentFile() {
+    reader_ = LogFileReader(filePath_);
+    readOffset_ = 0;
+    fingerprint_.clear();
+
+    struct stat st {};
+    if (::stat(filePath_.c_str(), &st) == 0) {
+        device_ = st.st_dev;
+        inode_ = st.st_ino;
+    }
+    watchCurrentFile();
+}
+
+bool LogFollower::isValid() const noexcept {
+    return reader_.isValid();
+}
+
+void LogFollower::drainReader(std::vector<std::string>& lines) {
+    if (!reader_.isValid()) {
+        return;
+    }
+
+    // 이전 호출에서 EOF 에 닿았더라도 새로 추가된 바이트부터 이어서 읽음
+    reader_.resumeAfterEof();
+
+    while (auto line = reader_.readNextLine()) {
+        bool terminated = reader_.isLastLineTerminated();
+        readOffset_ = reader_.getReadOffset(); // CRLF 의 '\r' 까지 포함한 원본 바이트 기준
+
+        if (!terminated) {
+            // 아직 쓰는 중인 라인: 개행이 들어올 때까지 보류
+            pendingLine_ += *line;
+            break;
+        }
+
+        if (pendingLine_.empty()) {
+            lines.push_back(std::move(*line));
+        } else {
+            pendingLine_ += *line;
+            lines.push_back(std::move(pendingLine_));
+            pendingLine_.clear();
+        }
+    }
+}
+
+void LogFollower::updateFingerprint() {
+    std::size_t length = static_cast<std::size_t>(std::min<std::uintmax_t>(readOffset_, FINGERPRINT_SIZE));
+    if (length == 0) {
+        fingerprint_.clear();
+        return;
+    }
+
+    ScopedFd fd(filePath_);
+    struct stat st {};
+    if (!fd.isOpen() || ::fstat(fd.get(), &st) != 0 || st.st_dev != device_ || st.st_ino != inode_) {
+        // 경로가 이미 다른 파일을 가리킴: 교체 감지에 맡기고 기존 지문 유지
+        return;
+    }
+
+    std::string bytes(length, '\0');
+    if (preadFully(fd.get(), bytes.data(), length, readOffset_ - length) != static_cast<ssize_t>(length)) {
+        return;
+    }
+    fingerprint_ = std::move(bytes);
+}
+
+bool LogFollower::fingerprintChanged() const {
+    if (fingerprint_.empty()) {
+        return false;
+    }
+
+    ScopedFd fd(filePath_);
+    if (!fd.isOpen()) {
+        return false;
+    }
+
+    std::string bytes(fingerprint_.size(), '\0');
+    ssize_t n = preadFully(fd.get(), bytes.data(), bytes.size(), readOffset_ - bytes.size());
+    return n != static_cast<ssize_t>(bytes.size()) || bytes != fingerprint_;
+}
+
+void LogFollower::restartFromBeginning(std::vector<std::string>& lines) {
+    // 이전 파일에서 완성되지 못한 조각도 버리지 않고 한 라인으로 내보냄
+    if (!pendingLine_.empty()) {
+        lines.push_back(std::move(pendingLine_));
+        pendingLine_.clear();
+    }
+
+    openCurrentFile();
+    ++rotationCount_;
+    drainReader(lines);
+    updateFingerprint();
+}
+
+std::vector<std::string> LogFollower::readAvailableLines() {
+    std::vector<std::string> lines;
+
+    if (!reader_.isValid()) {
+        return lines;
+    }
+
+    // 읽기 전에 truncate 여부를 먼저 확인: truncate 후 다시 커진 파일을
+    // 이전 위치부터 이어 읽으면 새 내용의 앞부분을 잃음
+    struct stat st {};
+    bool sameFile = ::stat(filePath_.c_str(), &st) == 0 && st.st_dev == device_ && st.st_ino == inode_;
+    if (sameFile && (static_cast<std::uintmax_t>(st.st_size) < readOffset_ || fingerprintChanged())) {
+        restartFromBeginning(lines);
+        return lines;
+    }
+
+    drainReader(lines);
+    updateFingerprint();
+
+    if (::stat(filePath_.c_str(), &st) != 0) {
+        // rename 후 새 파일이 아직 없음: 기존 디스크립터를 계속 사용
+        return lines;
+    }
+
+    bool replaced = st.st_dev != device_ || st.st_ino != inode_;
+    bool truncated = !replaced && static_cast<std::uintmax_t>(st.st_size) < readOffset_;
+    if (!replaced && !truncated) {
+        return lines;
+    }
+
+    if (replaced) {
+        // 전환 직전까지 이전 파일에 쓰인 내용을 마저 읽음
+        drainReader(lines);
+    }
+
+    restartFromBeginning(lines);
+    return lines;
+}
+
+bool LogFollower::waitForChanges(std::chrono::milliseconds timeout) {
+#ifdef __linux__
+    if (inotifyFd_ >= 0) {
+        pollfd pfd{};
+        pfd.fd = inotifyFd_;
+        pfd.events = POLLIN;
+
+        int ready = ::poll(&pfd, 1, static_cast<int>(timeout.count()));
+        if (ready <= 0) {
+            return false;
+        }
+
+        // 쌓인 이벤트는 모두 비움 (어떤 변경이든 다시 읽어보면 됨)
+        alignas(struct inotify_event) char buffer[4096];
+        while (::read(inotifyFd_, buffer, sizeof(buffer)) > 0) {
+        }
+        return true;
+    }
+#endif
+
+    std::this_thread::sleep_for(timeout);
+    return false;
+}
+
+std::string LogFollower::getFilePath() const noexcept {
+    return filePath_;
+}
+
+std::size_t LogFollower::getRotationCount() const noexcept {
+    return rotationCount_;
+}
+
+} // namespace LogAnalyzer
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "LogFileReader.hpp"
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <sys/types.h>
+
+namespace LogAnalyzer {
+
+// 계속 추가되는 로그 파일을 tail -f 처럼 따라가며 새 라인만 읽는 클래스
+// 변경 대기는 inotify 를 사용하고, 사용할 수 없으면 주기적 폴링으로 대체
+//
+// 로그 로테이션 처리:
+//  - rename + create: 경로의 inode 가 바뀌면 기존 디스크립터를 끝까지 읽은 뒤 새 파일로 전환
+//  - copytruncate: 파일 크기가 읽은 위치보다 작아지거나, 읽은 위치 직전 바이트(지문)가
+//    바뀌면 처음부터 다시 읽음 (폴링 사이에 truncate 후 다시 커진 경우도 감지)
+//    (마지막 읽기와 truncate 사이에 쓰인 내용은 복사본에만 남으므로 복구할 수 없음)
+class LogFollower {
+public:
+    explicit LogFollower(const std::string& filePath);
+    ~LogFollower();
+
+    // inotify 디스크립터를 소유하므로 복사/이동 금지
+    LogFollower(const LogFollower&) = delete;
+    LogFollower& operator=(const LogFollower&) = delete;
+    LogFollower(LogFollower&&) = delete;
+    LogFollower& operator=(LogFollower&&) = delete;
+
+    bool isValid() const noexcept;
+
+    // 마지막 호출 이후 추가된, 개행으로 끝난 라인들 (쓰는 중인 라인은 완성될 때까지 보류)
+    // 로테이션을 감지하면 이전 파일의 남은 라인과 새 파일의 라인을 순서대로 함께 반환
+    std::vector<std::string> readAvailableLines();
+
+    // 파일 변경을 최대 timeout 동안 대기 (변경 알림을 받으면 true)
+    bool waitForChanges(std::chrono::milliseconds timeout);
+
+    std::string getFilePath() const noexcept;
+    
+    // 지금까지 감지한 로테이션(교체 또는 truncate) 횟수
+    std::size_t getRotationCount() const noexcept;
+
+    // 내용 지문으로 보관하는 readOffset_ 직전 바이트 수
+    static constexpr std::size_t FINGERPRINT_SIZE = 64;
+
+private:
+    std::string filePath_;
+    LogFileReader reader_;
+    std::string pendingLine_;   // 개행 전에 EOF 에 닿은 라인 조각
+    std::uintmax_t readOffset_; // 현재 파일에서 소비한 바이트 수
+    dev_t device_;              // 현재 열린 파일의 장치/inode (교체 감지용)
+    ino_t inode_;
+    std::string fingerprint_;   // readOffset_ 직전 최대 FINGERPRINT_SIZE 바이트
+    std::size_t rotationCount_;
+    int inotifyFd_;
+    int fileWatch_;
+    int directoryWatch_;
+
+    void openCurrentFile();
+    void drainReader(std::vector<std::string>& lines);
+    void restartFromBeginning(std::vector<std::string>& lines);
+    void updateFingerprint();
+    bool fingerprintChanged() const;
+    void setupWatch();
+    void watchCurrentFile();
+};
+
+} // namespace LogAnalyzer
@@ -0,0 +1,338 @@
+#include "LogMerger.hpp"
+#include "LogFileReader.hpp"
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+#include <unordered_set>
+#include <system_error>
+#include <glob.h>
+
+namespace LogAnalyzer {
+
+namespace {
+
+// 읽기 스레드가 한 번에 넘기는 엔트리 수와 파일당 미리 채워 두는 묶음 수
+constexpr std::size_t PREFETCH_BATCH_SIZE = 256;
+constexpr std::size_t PREFETCH_BATCH_COUNT = 4;
+
+bool hasGlobPattern(const std::string& input) {
+    return input.find_first_of("*?[") != std::string::npos;
+}
+
+} // namespace
+
+// 파일 하나의 읽기 상태와 소비 상태
+// 읽기 쪽(reader, readOffset, error)은 scheduled 인 동안 그 파일을 맡은 워커 하나만 건드림
+struct LogMerger::Source {
+    explicit Source(std::string filePath) : path(std::move(filePath)), queue(PREFETCH_BATCH_COUNT) {}
+
+    std::string path;
+    BoundedQueue<std::vector<LogEntry>> queue;
+
+    // 읽기 쪽
+    std::optional<LogFileReader> reader;  // 채우는 동안만 열림 (압축/표준 입력은 되감을 수 없어 계속 유지)
+    std::uintmax_t readOffset = 0;        // 다시 열 때 이어 읽을 위치
+    std::string error;                    // 실패 사유 (queue.finish() 전에 기록)
+
+    // mutex_ 로 보호: 큐에 더 넣을 수 있는 묶음 수와 워커 배정 여부
+    std::size_t credits = PREFETCH_BATCH_COUNT;
+    bool scheduled = false;
+    bool exhausted = false;
+
+    // 소비 쪽
+    std::vector<LogEntry> batch;    // 소비 중인 묶음
+    std::size_t batchPos = 0;
+    std::optional<LogEntry> head;   // 힙에 올라가 있는 맨 앞 엔트리
+    std::int64_t lastKey = LogEntry::NO_EPOCH;  // 타임스탬프 없는 라인에 쓸 직전 키
+};
+
+LogMerger::LogMerger(const std::vector<std::string>& filePaths, std::size_t threadCount)
+    : filePaths_(filePaths), totalFileSize_(0), started_(false), failed_(false), stopping_(false) {
+    // 여기서는 존재 여부와 크기만 확인하고, 실제로 여는 것은 워커가 처음 채울 때
+    for (const auto& filePath : filePaths_) {
+        if (filePath != LogFileReader::STDIN_PATH) {
+            std::error_code ec;
+            if (!std::filesystem::exists(filePath, ec)) {
+                std::cerr << "파일 검증 실패: 파일이 존재하지 않습니다: " << filePath << std::endl;
+                continue;
+            }
+            if (!std::filesystem::is_regular_file(filePath, ec)) {
+                std::cerr << "파일 검증 실패: 일반 파일이 아닙니다: " << filePath << std::endl;
+                continue;
+            }
+            totalFileSize_ += std::filesystem::file_size(filePath, ec);
+        }
+        sources_.push_back(std::make_unique<Source>(filePath));
+    }
+
+    for (std::size_t i = 0; i < sources_.size(); ++i) {
+        sources_[i]->scheduled = true;
+        pending_.push_back(i);
+    }
+
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::size_t workerCount = std::min(threadCount, sources_.size());
+    for (std::size_t i = 0; i < workerCount; ++i) {
+        try {
+            workers_.emplace_back([this]() { workerLoop(); });
+        } catch (const std::system_error& e) {
+            std::cerr << "병합 읽기 스레드 생성 실패: " << e.what() << std::endl;
+            break;
+        }
+    }
+    if (workers_.empty()) {
+        sources_.clear();
+    }
+}
+
+LogMerger::~LogMerger() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    workReady_.notify_all();
+    for (auto& source : sources_) {
+        source->queue.cancel();
+    }
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void LogMerger::workerLoop() {
+    while (true) {
+        std::size_t sourceIndex = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            workReady_.wait(lock, [this]() { return stopping_ || !pending_.empty(); });
+            if (stopping_) {
+                return;
+            }
+            sourceIndex = pending_.front();
+            pending_.pop_front();
+        }
+        fillSource(sourceIndex);
+    }
+}
+
+void LogMerger::fillSource(std::size_t sourceIndex) {
+    Source& source = *sources_[sourceIndex];
+
+    // 워커 밖으로 나간 예외는 프로세스를 종료시키므로 실패 사유로 바꿔 소비자에게 넘김
+    bool finished = false;
+    try {
+        finished = readIntoQueue(source);
+    } catch (const std::exception& e) {
+        source.error = e.what();
+        finished = true;
+    }
+
+    bool keepOpen = !finished && source.reader && (source.reader->isCompressed() || source.reader->isStandardInput());
+    if (!keepOpen) {
+        source.reader.reset();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (finished) {
+        // exhausted 는 queue.finish() 보다 먼저 세워 소비자가 다시 배정하지 않게 함
+        source.exhausted = true;
+        source.queue.finish();
+        return;
+    }
+
+    // 읽는 사이 소비자가 돌려준 자리가 있으면 곧바로 다시 배정
+    source.scheduled = source.credits > 0;
+    if (source.scheduled) {
+        pending_.push_back(sourceIndex);
+        workReady_.notify_one();
+    }
+}
+
+bool LogMerger::takeCredit(Source& source) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopping_ || source.credits == 0) {
+        return false;
+    }
+    --source.credits;
+    return true;
+}
+
+// 큐에 자리가 있는 만큼 묶음을 채움, 파일을 끝까지 읽었거나 실패하면 true
+bool LogMerger::readIntoQueue(Source& source) {
+    if (!source.reader) {
+        source.reader.emplace(source.path);
+        if (!source.reader->isValid()) {
+            source.error = "파일을 열 수 없습니다";
+            return true;
+        }
+        if (source.readOffset > 0 && !source.reader->seekTo(source.readOffset)) {
+            source.error = "읽던 위치로 이동할 수 없습니다";
+            return true;
+        }
+    }
+
+    LogParser parser;
+    LineBatch lines;
+    std::string line;
+
+    // 자리를 먼저 받아 두므로 push 는 대기하지 않음 (워커가 한 파일에 묶여 멈추지 않음)
+    while (takeCredit(source)) {
+        if (source.reader->readLines(lines, PREFETCH_BATCH_SIZE) == 0) {
+            if (source.reader->hasReadError()) {
+                source.error = "입력을 끝까지 읽지 못했습니다";
+            }
+            return true;
+        }
+
+        std::vector<LogEntry> batch;
+        batch.reserve(lines.size());
+        for (std::size_t i = 0; i < lines.size(); ++i) {
+            line.assign(lines[i]);
+            batch.push_back(parser.parseLine(line));
+        }
+        source.readOffset = source.reader->getReadOffset();
+
+        if (!source.queue.push(std::move(batch))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void LogMerger::returnCredit(std::size_t sourceIndex) {
+    Source& source = *sources_[sourceIndex];
+    bool schedule = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++source.credits;
+        if (!source.scheduled && !source.exhausted) {
+            source.scheduled = true;
+            pending_.push_back(sourceIndex);
+            schedule = true;
+        }
+    }
+    if (schedule) {
+        workReady_.notify_one();
+    }
+}
+
+bool LogMerger::isValid() const noexcept {
+    return !sources_.empty();
+}
+
+void LogMerger::advance(std::size_t sourceIndex) {
+    Source& source = *sources_[sourceIndex];
+    source.head.reset();
+
+    if (source.batchPos >= source.batch.size()) {
+        auto batch = source.queue.pop();
+        if (!batch) {
+            // 이 파일은 소진됨 (워커가 실패로 끝냈다면 사유를 보고)
+            if (!source.error.empty()) {
+                std::cerr << "병합 입력 읽기 실패: " << source.path << " (" << source.error << ")" << std::endl;
+                failed_ = true;
+            }
+            return;
+        }
+        source.batch = std::move(*batch);
+        source.batchPos = 0;
+        returnCredit(sourceIndex);
+    }
+
+    source.head = std::move(source.batch[source.batchPos++]);
+    if (source.head->hasEpoch()) {
+        source.lastKey = source.head->epochMs;
+    }
+    heap_.push(HeapItem{source.lastKey, sourceIndex});
+}
+
+std::optional<LogEntry> LogMerger::next() {
+    if (!started_) {
+        started_ = true;
+        for (std::size_t i = 0; i < sources_.size(); ++i) {
+            advance(i);
+        }
+    }
+
+    if (heap_.empty()) {
+        return std::nullopt;
+    }
+
+    std::size_t sourceIndex = heap_.top().sourceIndex;
+    heap_.pop();
+
+    LogEntry entry = std::move(*sources_[sourceIndex]->head);
+    advance(sourceIndex);
+    return entry;
+}
+
+std::vector<LogEntry> LogMerger::mergeAll() {
+    std::vector<LogEntry> entries;
+    while (auto entry = next()) {
+        entries.push_back(std::move(*entry));
+    }
+    return entries;
+}
+
+bool LogMerger::hasErrors() const noexcept {
+    return failed_;
+}
+
+std::uintmax_t LogMerger::getTotalFileSize() const noexcept {
+    return totalFileSize_;
+}
+
+const std::vector<std::string>& LogMerger::getFilePaths() const noexcept {
+    return filePaths_;
+}
+
+std::vector<std::string> LogMerger::expandInputs(const std::vector<std::string>& inputs) {
+    std::vector<std::string> files;
+    std::unordered_set<std::string> seen;
+
+    // 같은 파일을 가리키는 서로 다른 표기(./a.log, dir/../a.log)도 하나로 봄
+    auto addFile = [&files, &seen](const std::string& file) {
+        std::error_code ec;
+        std::filesystem::path canonical = std::filesystem::weakly_canonical(file, ec);
+        if (seen.insert(ec ? file : canonical.string()).second) {
+            files.push_back(file);
+        }
+    };
+
+    for (const auto& input : inputs) {
+        std::error_code ec;
+        if (std::filesystem::is_directory(input, ec)) {
+            std::vector<std::string> directoryFiles;
+            for (const auto& item : std::filesystem::directory_iterator(input, ec)) {
+                std::string name = item.path().filename().string();
+                if (item.is_regular_file(ec) && !name.empty() && name[0] != '.') {
+                    directoryFiles.push_back(item.path().string());
+                }
+            }
+            std::sort(directoryFiles.begin(), directoryFiles.end());
+            for (const auto& file : directoryFiles) {
+                addFile(file);
+            }
+        } else if (hasGlobPattern(input) && !std::filesystem::exists(input, ec)) {
+            glob_t matches{};
+            if (::glob(input.c_str(), 0, nullptr, &matches) == 0) {
+                for (std::size_t i = 0; i < matches.gl_pathc; ++i) {
+                    if (std::filesystem::is_regular_file(matches.gl_pathv[i], ec)) {
+                        addFile(matches.gl_pathv[i]);
+                    }
+                }
+            } else {
+                std::cerr << "일치하는 파일이 없습니다: " << input << std::endl;
+            }
+            ::globfree(&matches);
+        } else {
+            addFile(input);
+        }
+    }
+
+    return files;
+}
+
+} // namespace LogAnalyzer
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "LogParser.hpp"
+#include "BoundedQueue.hpp"
+#include <string>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+namespace LogAnalyzer {
+
+// 여러 로그 파일을 타임스탬프 순서로 병합해 읽는 클래스
+// 고정 개수의 읽기/파싱 스레드가 파일별 크기 제한 큐를 번갈아 채우고, 힙 기반 k-way 병합으로 꺼냄
+// 파일은 채울 차례가 된 스레드가 열고, 비압축 파일은 채운 뒤 닫았다가 읽던 위치부터 다시 열므로
+// 동시에 열린 디스크립터 수는 파일 수가 아니라 스레드 수에 비례 (압축 입력은 해제 상태 때문에 계속 열어 둠)
+// 메모리 사용량은 전체 크기가 아니라 파일 수에 비례
+class LogMerger {
+public:
+    // threadCount 가 0 이면 하드웨어 스레드 수를 사용 (파일 수보다 많이 만들지 않음)
+    explicit LogMerger(const std::vector<std::string>& filePaths, std::size_t threadCount = 0);
+    ~LogMerger();
+
+    // 읽기 스레드와 큐를 소유하므로 복사/이동 금지
+    LogMerger(const LogMerger&) = delete;
+    LogMerger& operator=(const LogMerger&) = delete;
+    LogMerger(LogMerger&&) = delete;
+    LogMerger& operator=(LogMerger&&) = delete;
+
+    // 하나 이상의 파일을 읽을 수 있으면 true
+    bool isValid() const noexcept;
+
+    // 타임스탬프가 가장 이른 다음 엔트리 (모든 파일을 소진하면 std::nullopt)
+    // 같은 시각이면 입력 순서가 앞선 파일이 먼저, 타임스탬프 없는 라인은 같은 파일의 직전 라인을 따름
+    std::optional<LogEntry> next();
+
+    // 남은 엔트리 전체를 병합 순서로 읽기
+    std::vector<LogEntry> mergeAll();
+
+    // 읽는 도중 실패한 파일이 있었는지 (해당 파일은 실패 지점까지만 병합되고 오류는 표준 에러로 보고)
+    bool hasErrors() const noexcept;
+
+    std::uintmax_t getTotalFileSize() const noexcept;
+    const std::vector<std::string>& getFilePaths() const noexcept;
+
+    // 파일 경로, 디렉터리(바로 아래 일반 파일), 글롭 패턴을 정렬된 파일 목록으로 확장
+    // 디렉터리와 글롭이 겹치는 등 같은 파일이 여러 번 나오면 처음 것만 남김
+    static std::vector<std::string> expandInputs(const std::vector<std::string>& inputs);
+
+private:
+    struct Source;
+
+    // 힙 항목: 각 파일의 맨 앞 엔트리 정렬 키 (에포크 밀리초, 문자열 비교/복사 없음)
+    struct HeapItem {
+        std::int64_t key;
+        std::size_t sourceIndex;
+
+        // std::priority_queue 는 최대 힙이므로 순서를 뒤집음
+        bool operator<(const HeapItem& other) const {
+            if (key != other.key) {
+                return key > other.key;
+            }
+            return sourceIndex > other.sourceIndex;
+        }
+    };
+
+    std::vector<std::string> filePaths_;
+    std::vector<std::unique_ptr<Source>> sources_;
+    std::priority_queue<HeapItem> heap_;
+    std::uintmax_t totalFileSize_;
+    bool started_;
+    bool failed_;
+
+    // 읽기 스레드 풀: 채울 차례가 된 파일 번호를 pending_ 에서 꺼내 처리
+    std::mutex mutex_;
+    std::condition_variable workReady_;
+    std::deque<std::size_t> pending_;
+    bool stopping_;
+    std::vector<std::thread> workers_;
+
+    void advance(std::size_t sourceIndex);
+    void returnCredit(std::size_t sourceIndex);
+    bool takeCredit(Source& source);
+    void workerLoop();
+    void fillSource(std::size_t sourceIndex);
+    bool readIntoQueue(Source& source);
+};
+
+} // namespace LogAnalyzer
@@ -1,47 +1,455 @@
 #include "LogParser.hpp"
 #include <algorithm>
-#include <sstream>
+#include <cstring>
+#include <iterator>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace LogAnalyzer {
 
-LogParser::LogParser() 
-    : timestampRegex_(R"(\d{4}-\d{2}-\d{2}\s\d{2}:\d{2}:\d{2})") {
-    initializeLevelMap();
+namespace {
+
+inline bool isDigit(char c) noexcept {
+    return c >= '0' && c <= '9';
+}
+
+// 정규식 \s 와 같은 공백 문자
+inline bool isSpace(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+// p 부터 "DDDD-DD-DD DD:DD:DD" 형태인지 (p 뒤로 TIMESTAMP_LENGTH 바이트가 있어야 함)
+inline bool matchesTimestampAt(const char* p) noexcept {
+    return isDigit(p[0]) && isDigit(p[1]) && isDigit(p[2]) && isDigit(p[3]) && p[4] == '-' &&
+           isDigit(p[5]) && isDigit(p[6]) && p[7] == '-' &&
+           isDigit(p[8]) && isDigit(p[9]) && isSpace(p[10]) &&
+           isDigit(p[11]) && isDigit(p[12]) && p[13] == ':' &&
+           isDigit(p[14]) && isDigit(p[15]) && p[16] == ':' &&
+           isDigit(p[17]) && isDigit(p[18]);
+}
+
+// 1970-01-01 부터의 일 수 (그레고리력, 음수 연도 포함)
+constexpr std::int64_t daysFromCivil(std::int64_t year, unsigned month, unsigned day) noexcept {
+    year -= month <= 2 ? 1 : 0;
+    std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+    auto yearOfEra = static_cast<unsigned>(year - era * 400);
+    unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + static_cast<std::int64_t>(dayOfEra) - 719468;
+}
+
+constexpr bool isLeapYear(unsigned year) noexcept {
+    return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+}
+
+inline unsigned twoDigits(const char* p) noexcept {
+    return static_cast<unsigned>(p[0] - '0') * 10 + static_cast<unsigned>(p[1] - '0');
+}
+
+// "YYYY-MM-DD HH" 앞부분
+constexpr std::size_t HOUR_PREFIX_LENGTH = 13;
+
+// 마지막으로 계산한 시각 앞부분과 그 정각의 에포크 밀리초
+struct HourCache {
+    char prefix[HOUR_PREFIX_LENGTH] = {};
+    std::int64_t hourStartMs = LogEntry::NO_EPOCH;
+    bool filled = false;
+};
+
+thread_local HourCache hourCache;
+
+// 달력 계산 (HourCache 가 빗나갔을 때만)
+std::int64_t hourStartEpochMs(const char* p) noexcept {
+    unsigned year = twoDigits(p) * 100 + twoDigits(p + 2);
+    unsigned month = twoDigits(p + 5);
+    unsigned day = twoDigits(p + 8);
+    unsigned hour = twoDigits(p + 11);
+
+    static constexpr unsigned DAYS_IN_MONTH[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month < 1 || month > 12 || day < 1 || hour > 23) {
+        return LogEntry::NO_EPOCH;
+    }
+    unsigned monthDays = DAYS_IN_MONTH[month - 1] + (month == 2 && isLeapYear(year) ? 1 : 0);
+    if (day > monthDays) {
+        return LogEntry::NO_EPOCH;
+    }
+
+    std::int64_t days = daysFromCivil(year, month, day);
+    return (days * 24 + hour) * 3600 * 1000;
+}
+
+inline bool isAsciiLetter(char c) noexcept {
+    return static_cast<unsigned char>((c | 0x20) - 'a') < 26;
+}
+
+// 레벨 단어의 첫 글자인지 (대소문자 무시)
+inline bool isLevelInitial(char c) noexcept {
+    char lower = static_cast<char>(c | 0x20);
+    return lower == 'e' || lower == 'w' || lower == 'i' || lower == 'd';
+}
+
+// 영문자만으로 이루어진 token 이 대문자 word 와 같은지 (대소문자 무시)
+inline bool equalsUpper(const char* token, const char* word, std::size_t length) noexcept {
+    for (std::size_t i = 0; i < length; ++i) {
+        if ((token[i] & ~0x20) != word[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 가장 긴 레벨 단어 "WARNING" 의 길이
+constexpr std::size_t MAX_LEVEL_TOKEN_LENGTH = 7;
+
+// line[start] 에서 시작하는 영문자 토큰이 레벨 단어이면 그 레벨 (앞 글자가 영문자가 아님은 호출자가 확인)
+// end 에는 토큰이 끝나는 위치를 기록
+LogLevel levelTokenAt(std::string_view line, std::size_t start, std::size_t& end) noexcept {
+    end = start;
+    while (end < line.size() && end - start <= MAX_LEVEL_TOKEN_LENGTH && isAsciiLetter(line[end])) {
+        ++end;
+    }
+    const char* token = line.data() + start;
+    switch (end - start) {
+        case 3:
+            if (equalsUpper(token, "ERR", 3)) return LogLevel::ERROR;
+            if (equalsUpper(token, "DBG", 3)) return LogLevel::DEBUG;
+            break;
+        case 4:
+            if (equalsUpper(token, "WARN", 4)) return LogLevel::WARNING;
+            if (equalsUpper(token, "INFO", 4)) return LogLevel::INFO;
+            break;
+        case 5:
+            if (equalsUpper(token, "ERROR", 5)) return LogLevel::ERROR;
+            if (equalsUpper(token, "DEBUG", 5)) return LogLevel::DEBUG;
+            break;
+        case 7:
+            if (equalsUpper(token, "WARNING", 7)) return LogLevel::WARNING;
+            break;
+        default:
+            break;
+    }
+    return LogLevel::UNKNOWN;
+}
+
+// 후보 위치가 토큰의 시작이면 그 토큰의 레벨
+inline LogLevel levelCandidateAt(std::string_view line, std::size_t position, std::size_t& end) noexcept {
+    if (position > 0 && isAsciiLetter(line[position - 1])) {
+        return LogLevel::UNKNOWN;
+    }
+    return levelTokenAt(line, position, end);
+}
+
+// line[begin] 부터 앞뒤 공백을 뺀 구간 (복사 없이 원본을 가리킴)
+std::string_view trimmedFrom(std::string_view line, std::size_t begin) noexcept {
+    std::size_t end = line.size();
+    while (begin < end && isSpace(line[begin])) {
+        ++begin;
+    }
+    while (end > begin && isSpace(line[end - 1])) {
+        --end;
+    }
+    return line.substr(begin, end - begin);
+}
+
+} // namespace
+
+CompactLogBatch CompactLogBatch::filter(const std::function<bool(const CompactLogEntry&)>& predicate) const {
+    CompactLogBatch filtered;
+    filtered.segments_ = segments_;
+    filtered.byteSize_ = byteSize_;
+    std::copy_if(entries_.begin(), entries_.end(), std::back_inserter(filtered.entries_), predicate);
+    return filtered;
+}
+
+void CompactLogBatch::retain(const std::function<bool(const CompactLogEntry&)>& predicate) {
+    entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                  [&predicate](const CompactLogEntry& entry) { return !predicate(entry); }),
+                   entries_.end());
+}
+
+void CompactLogBatch::append(CompactLogBatch&& other) {
+    // other 의 바이트 공간을 이 묶음의 끝 뒤로 옮겨 붙임 (버퍼는 복사하지 않음)
+    entries_.reserve(entries_.size() + other.entries_.size());
+    for (CompactLogEntry entry : other.entries_) {
+        entry.lineOffset += byteSize_;
+        entries_.push_back(entry);
+    }
+    for (auto& segment : other.segments_) {
+        segments_.push_back({segment.base + byteSize_, std::move(segment.bytes)});
+    }
+    byteSize_ += other.byteSize_;
+    other = CompactLogBatch();
+}
+
+std::string_view CompactLogBatch::line(const CompactLogEntry& entry) const noexcept {
+    // 라인을 담은 버퍼는 시작 위치가 lineOffset 이하인 마지막 구간
+    auto segment = segments_.begin();
+    if (segments_.size() > 1) {
+        segment = std::prev(std::upper_bound(segments_.begin(), segments_.end(), entry.lineOffset,
+                                             [](std::uint64_t offset, const Segment& s) { return offset < s.base; }));
+    }
+    if (segment == segments_.end()) {
+        return {};
+    }
+    return std::string_view(segment->bytes->data() + (entry.lineOffset - segment->base), entry.lineLength);
 }
 
-void LogParser::initializeLevelMap() {
-    levelMap_["ERROR"] = LogLevel::ERROR;
-    levelMap_["ERR"] = LogLevel::ERROR;
-    levelMap_["WARN"] = LogLevel::WARNING;
-    levelMap_["WARNING"] = LogLevel::WARNING;
-    levelMap_["INFO"] = LogLevel::INFO;
-    levelMap_["DEBUG"] = LogLevel::DEBUG;
-    levelMap_["DBG"] = LogLevel::DEBUG;
+std::string_view CompactLogBatch::message(const CompactLogEntry& entry) const noexcept {
+    return line(entry).substr(entry.messageOffset, entry.messageLength);
+}
+
+std::string_view CompactLogBatch::timestamp(const CompactLogEntry& entry) const noexcept {
+    std::string_view text = line(entry);
+    std::size_t start = LogParser::findTimestamp(text);
+    return start == std::string_view::npos ? std::string_view() : text.substr(start, LogParser::TIMESTAMP_LENGTH);
+}
+
+LogEntry CompactLogBatch::materialize(const CompactLogEntry& entry) const {
+    return LogEntry(std::string(line(entry)), entry.level, std::string(timestamp(entry)),
+                    std::string(message(entry)), entry.epochMs);
+}
+
+std::string_view ParsedBatch::message(std::string_view bytes, std::size_t i) const noexcept {
+    std::string_view text = line(bytes, i);
+    std::size_t begin = static_cast<std::size_t>(msgOffset[i] - lineOffset[i]);
+    if (begin == 0) {
+        return text;
+    }
+    return trimmedFrom(text, begin);
+}
+
+LogParser::LogParser() = default;
+
+// atomic 은 복사할 수 없으므로 값을 읽어 옮김
+LogParser::LogParser(const LogParser& other) noexcept {
+    copyFastPathStats(other);
+}
+
+LogParser& LogParser::operator=(const LogParser& other) noexcept {
+    if (this != &other) {
+        copyFastPathStats(other);
+    }
+    return *this;
+}
+
+LogParser::LogParser(LogParser&& other) noexcept {
+    copyFastPathStats(other);
+}
+
+LogParser& LogParser::operator=(LogParser&& other) noexcept {
+    if (this != &other) {
+        copyFastPathStats(other);
+    }
+    return *this;
 }
 
 LogEntry LogParser::parseLine(const std::string& line) const {
-    if (line.empty()) {
-        return LogEntry(line, LogLevel::UNKNOWN);
+    bool fastPath = false;
+    LogEntry entry = parseLine(line, fastPath);
+    recordFastPath(1, fastPath ? 1 : 0);
+    return entry;
+}
+
+LogEntry LogParser::parseLine(const std::string& line, bool& fastPath) {
+    LineFields fields = parseFields(line, fastPath);
+    return LogEntry(line, fields.level, std::string(fields.timestamp), std::string(fields.message), fields.epochMs);
+}
+
+LogParser::LineFields LogParser::parseFields(std::string_view line, bool& fastPath) noexcept {
+    LineFields fields;
+    fastPath = parseCanonicalFields(line, fields);
+    if (fastPath) {
+        return fields;
     }
     
-    LogLevel level = detectLogLevel(line);
-    std::string timestamp = extractTimestamp(line);
-    std::string message = extractMessage(line);
-    
-    return LogEntry(line, level, timestamp, message);
+    std::size_t levelEnd = std::string_view::npos;
+    fields.level = detectLogLevel(line, &levelEnd);
+    std::size_t timestampStart = findTimestamp(line);
+    std::size_t timestampEnd = std::string_view::npos;
+    if (timestampStart != std::string_view::npos) {
+        fields.timestamp = line.substr(timestampStart, TIMESTAMP_LENGTH);
+        fields.epochMs = timestampToEpochMs(fields.timestamp);
+        timestampEnd = timestampStart + TIMESTAMP_LENGTH;
+    }
+    fields.message = extractMessage(line, timestampEnd, levelEnd);
+    return fields;
 }
 
 std::vector<LogEntry> LogParser::parseLines(const std::vector<std::string>& lines) const {
     std::vector<LogEntry> entries;
     entries.reserve(lines.size());
     
+    // 카운터는 라인마다가 아니라 묶음마다 한 번만 갱신 (여러 스레드가 같은 파서를 쓸 때 경합 방지)
+    std::uint64_t hits = 0;
     for (const auto& line : lines) {
-        entries.emplace_back(parseLine(line));
+        bool fastPath = false;
+        entries.emplace_back(parseLine(line, fastPath));
+        hits += fastPath ? 1 : 0;
     }
+    recordFastPath(lines.size(), hits);
     
     return entries;
 }
 
+std::vector<LogEntry> LogParser::parseLines(const std::vector<std::string>& lines, ThreadPool& pool) const {
+    std::vector<LogEntry> entries(lines.size());
+    forEachSlice(lines.size(), pool, [&](std::size_t begin, std::size_t end) {
+        std::uint64_t hits = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            bool fastPath = false;
+            entries[i] = parseLine(lines[i], fastPath);
+            hits += fastPath ? 1 : 0;
+        }
+        recordFastPath(end - begin, hits);
+    });
+    return entries;
+}
+
+CompactLogBatch LogParser::parseCompact(LineBatch&& lines) const {
+    CompactLogBatch batch;
+    batch.entries_.resize(lines.size());
+    parseCompactRange(lines, 0, lines.size(), batch.entries_.data());
+    adoptLineBuffer(batch, std::move(lines));
+    return batch;
+}
+
+CompactLogBatch LogParser::parseCompact(LineBatch&& lines, ThreadPool& pool) const {
+    CompactLogBatch batch;
+    batch.entries_.resize(lines.size());
+    forEachSlice(lines.size(), pool, [&](std::size_t begin, std::size_t end) {
+        parseCompactRange(lines, begin, end, batch.entries_.data() + begin);
+    });
+    adoptLineBuffer(batch, std::move(lines));
+    return batch;
+}
+
+void LogParser::parseCompactRange(const LineBatch& lines, std::size_t begin, std::size_t end,
+                                  CompactLogEntry* out) const {
+    const char* base = lines.bytes().data();
+    std::uint64_t hits = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+        std::string_view line = lines[i];
+        bool fastPath = false;
+        LineFields fields = parseFields(line, fastPath);
+        hits += fastPath ? 1 : 0;
+        
+        CompactLogEntry& entry = *out++;
+        entry.epochMs = fields.epochMs;
+        entry.lineOffset = static_cast<std::uint64_t>(line.data() - base);
+        entry.lineLength = static_cast<std::uint32_t>(line.size());
+        entry.messageOffset = static_cast<std::uint32_t>(fields.message.data() - line.data());
+        entry.messageLength = static_cast<std::uint32_t>(fields.message.size());
+        entry.level = fields.level;
+    }
+    recordFastPath(end - begin, hits);
+}
+
+void LogParser::adoptLineBuffer(CompactLogBatch& batch, LineBatch&& lines) {
+    // 라인 위치는 버퍼 시작 기준이므로 버퍼를 옮겨도 그대로 유효
+    batch.byteSize_ = lines.bytes().size();
+    if (batch.byteSize_ > 0) {
+        batch.segments_.push_back({0, std::make_shared<const std::string>(lines.releaseBytes())});
+    }
+    lines.clear();
+}
+
+void LogParser::forEachSlice(std::size_t count, ThreadPool& pool,
+                             const std::function<void(std::size_t begin, std::size_t end)>& parseSlice) {
+    // 스레드마다 몇 개씩 맡겨 느린 구간이 있어도 나머지 스레드가 이어 받도록 함
+    std::size_t sliceCount = std::min((count + PARALLEL_MIN_LINES - 1) / PARALLEL_MIN_LINES, pool.size() * 4);
+    if (sliceCount <= 1) {
+        parseSlice(0, count);
+        return;
+    }
+    std::size_t sliceSize = (count + sliceCount - 1) / sliceCount;
+    pool.run(sliceCount, [&](std::size_t slice) {
+        std::size_t begin = slice * sliceSize;
+        parseSlice(begin, std::min(begin + sliceSize, count));
+    });
+}
+
+void LogParser::recordFastPath(std::uint64_t lines, std::uint64_t hits) const noexcept {
+    parsedLines_.value.fetch_add(lines, std::memory_order_relaxed);
+    if (hits > 0) {
+        fastPathHits_.value.fetch_add(hits, std::memory_order_relaxed);
+    }
+}
+
+void LogParser::copyFastPathStats(const LogParser& other) noexcept {
+    parsedLines_.value.store(other.parsedLines_.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    fastPathHits_.value.store(other.fastPathHits_.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void LogParser::parseBatch(const LineBatch& lines, ParsedBatch& out) const {
+    out.clear();
+    out.resize(lines.size());
+    parseBatchRange(lines, 0, lines.size(), out);
+    out.lineOffset[lines.size()] = lines.bytes().size();
+}
+
+void LogParser::parseBatch(const LineBatch& lines, ParsedBatch& out, ThreadPool& pool) const {
+    out.clear();
+    out.resize(lines.size());
+    forEachSlice(lines.size(), pool, [&](std::size_t begin, std::size_t end) {
+        parseBatchRange(lines, begin, end, out);
+    });
+    out.lineOffset[lines.size()] = lines.bytes().size();
+}
+
+void LogParser::parseBatchRange(const LineBatch& lines, std::size_t begin, std::size_t end, ParsedBatch& out) const {
+    const char* base = lines.bytes().data();
+    std::uint64_t hits = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+        std::string_view line = lines[i];
+        bool fastPath = false;
+        LineFields fields = parseFields(line, fastPath);
+        hits += fastPath ? 1 : 0;
+        
+        out.levels[i] = fields.level;
+        out.epochMs[i] = fields.epochMs;
+        out.lineOffset[i] = static_cast<std::uint64_t>(line.data() - base);
+        out.msgOffset[i] = static_cast<std::uint64_t>(fields.message.data() - base);
+    }
+    recordFastPath(end - begin, hits);
+}
+
+bool LogParser::parseCanonicalFields(std::string_view line, LineFields& fields) noexcept {
+    constexpr std::size_t LEVEL_OFFSET = TIMESTAMP_LENGTH + 1;
+    if (line.size() <= LEVEL_OFFSET || line[10] != ' ' || line[TIMESTAMP_LENGTH] != ' ' ||
+        !matchesTimestampAt(line.data())) {
+        return false;
+    }
+    
+    std::size_t levelEnd = 0;
+    LogLevel level = levelTokenAt(line, LEVEL_OFFSET, levelEnd);
+    if (level == LogLevel::UNKNOWN || levelEnd == line.size() || !isSpace(line[levelEnd])) {
+        return false;
+    }
+    
+    // 메시지가 비어 있으면 일반 경로와 같이 원본 라인을 메시지로 쓰도록 넘김
+    std::string_view message = trimmedFrom(line, levelEnd);
+    if (message.empty()) {
+        return false;
+    }
+    
+    fields.level = level;
+    fields.timestamp = line.substr(0, TIMESTAMP_LENGTH);
+    fields.message = message;
+    fields.epochMs = timestampToEpochMs(fields.timestamp);
+    return true;
+}
+
+LogParser::FastPathStats LogParser::fastPathStats() const noexcept {
+    return {parsedLines_.value.load(std::memory_order_relaxed), fastPathHits_.value.load(std::memory_order_relaxed)};
+}
+
+void LogParser::resetFastPathStats() noexcept {
+    parsedLines_.value.store(0, std::memory_order_relaxed);
+    fastPathHits_.value.store(0, std::memory_order_relaxed);
+}
+
 std::vector<LogEntry> LogParser::filterByKeyword(const std::vector<LogEntry>& entries, 
                                                 const std::string& keyword) const {
     if (keyword.empty()) {
@@ -70,49 +478,134 @@ std::vector<LogEntry> LogParser::filterByLevel(const std::vector<LogEntry>& entr
     return filtered;
 }
 
-LogLevel LogParser::detectLogLevel(const std::string& line) const {
-    // 대소문자 구분없이 검색하기 위해 대문자로 변환
-    std::string upperLine = line;
-    std::transform(upperLine.begin(), upperLine.end(), upperLine.begin(), ::toupper);
+CompactLogBatch LogParser::filterByKeyword(const CompactLogBatch& entries, const std::string& keyword) const {
+    if (keyword.empty()) {
+        return entries;
+    }
+    return entries.filter([&entries, &keyword](const CompactLogEntry& entry) {
+        return entries.line(entry).find(keyword) != std::string_view::npos;
+    });
+}
+
+CompactLogBatch LogParser::filterByLevel(const CompactLogBatch& entries, LogLevel level) const {
+    return entries.filter([level](const CompactLogEntry& entry) {
+        return entry.level == level;
+    });
+}
+
+LogLevel LogParser::detectLogLevel(std::string_view line, std::size_t* levelEnd) noexcept {
+    std::size_t position = 0;
+    std::size_t end = 0;
     
-    for (const auto& [levelStr, level] : levelMap_) {
-        if (upperLine.find(levelStr) != std::string::npos) {
-            return level;
+#if defined(__SSE2__)
+    // 0x20 을 OR 해 소문자로 맞춘 뒤 e/w/i/d 와 비교한 마스크의 비트만 후보로 검사
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    const __m128i e = _mm_set1_epi8('e');
+    const __m128i w = _mm_set1_epi8('w');
+    const __m128i i = _mm_set1_epi8('i');
+    const __m128i d = _mm_set1_epi8('d');
+    for (; position + 16 <= line.size(); position += 16) {
+        __m128i lower = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(line.data() + position)), caseBit);
+        __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(lower, e), _mm_cmpeq_epi8(lower, w)),
+                                    _mm_or_si128(_mm_cmpeq_epi8(lower, i), _mm_cmpeq_epi8(lower, d)));
+        auto mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        while (mask != 0) {
+            LogLevel level = levelCandidateAt(line, position + static_cast<std::size_t>(__builtin_ctz(mask)), end);
+            if (level != LogLevel::UNKNOWN) {
+                if (levelEnd != nullptr) {
+                    *levelEnd = end;
+                }
+                return level;
+            }
+            mask &= mask - 1;
         }
     }
+#endif
     
+    for (; position < line.size(); ++position) {
+        if (isLevelInitial(line[position])) {
+            LogLevel level = levelCandidateAt(line, position, end);
+            if (level != LogLevel::UNKNOWN) {
+                if (levelEnd != nullptr) {
+                    *levelEnd = end;
+                }
+                return level;
+            }
+        }
+    }
     return LogLevel::UNKNOWN;
 }
 
-std::string LogParser::extractTimestamp(const std::string& line) const {
-    std::smatch match;
-    if (std::regex_search(line, match, timestampRegex_)) {
-        return match.str();
+std::size_t LogParser::findTimestamp(std::string_view line) noexcept {
+    if (line.size() < TIMESTAMP_LENGTH) {
+        return std::string_view::npos;
+    }
+    
+    // 후보 위치는 다섯 번째 글자가 '-' 인 곳뿐이므로 memchr 로 '-' 만 찾아 건너뜀
+    const char* data = line.data();
+    std::size_t last = line.size() - TIMESTAMP_LENGTH;
+    std::size_t start = 0;
+    while (start <= last) {
+        const void* dash = std::memchr(data + start + 4, '-', last - start + 1);
+        if (dash == nullptr) {
+            break;
+        }
+        start = static_cast<std::size_t>(static_cast<const char*>(dash) - data) - 4;
+        if (matchesTimestampAt(data + start)) {
+            return start;
+        }
+        ++start;
     }
-    return "";
+    return std::string_view::npos;
 }
 
-std::string LogParser::extractMessage(const std::string& line) const {
-    // 간단한 메시지 추출 (타임스탬프와 로그 레벨 이후의 내용)
-    std::istringstream iss(line);
-    std::string token;
-    std::vector<std::string> tokens;
-    
-    while (iss >> token) {
-        tokens.push_back(token);
+std::int64_t LogParser::timestampToEpochMs(std::string_view timestamp) noexcept {
+    if (timestamp.size() != TIMESTAMP_LENGTH || !matchesTimestampAt(timestamp.data())) {
+        return LogEntry::NO_EPOCH;
     }
-    
-    // 최소 3개 토큰이 있으면 (날짜, 시간, 레벨) 나머지를 메시지로 간주
-    if (tokens.size() > 3) {
-        std::ostringstream message;
-        for (size_t i = 3; i < tokens.size(); ++i) {
-            if (i > 3) message << " ";
-            message << tokens[i];
+    const char* p = timestamp.data();
+
+    if (!hourCache.filled || std::memcmp(hourCache.prefix, p, HOUR_PREFIX_LENGTH) != 0) {
+        std::memcpy(hourCache.prefix, p, HOUR_PREFIX_LENGTH);
+        hourCache.hourStartMs = hourStartEpochMs(p);
+        hourCache.filled = true;
+    }
+
+    unsigned minute = twoDigits(p + 14);
+    unsigned second = twoDigits(p + 17);
+    if (hourCache.hourStartMs == LogEntry::NO_EPOCH || minute > 59 || second > 59) {
+        return LogEntry::NO_EPOCH;
+    }
+    return hourCache.hourStartMs + (static_cast<std::int64_t>(minute) * 60 + second) * 1000;
+}
+
+std::string LogParser::extractTimestamp(const std::string& line) const {
+    std::size_t start = findTimestamp(line);
+    if (start == std::string_view::npos) {
+        return "";
+    }
+    return line.substr(start, TIMESTAMP_LENGTH);
+}
+
+std::string_view LogParser::extractMessage(std::string_view line, std::size_t timestampEnd,
+                                          std::size_t levelEnd) noexcept {
+    // 레벨 토큰 뒤 (레벨이 없으면 타임스탬프 뒤) 부터가 메시지
+    std::size_t begin = levelEnd;
+    if (begin == std::string_view::npos || (timestampEnd != std::string_view::npos && timestampEnd > begin)) {
+        begin = timestampEnd;
+    } else {
+        // "[ERROR]", "ERROR:" 처럼 레벨에 붙은 닫는 구분 기호는 메시지에서 뺌
+        while (begin < line.size() && (line[begin] == ':' || line[begin] == ']' || line[begin] == '>' ||
+                                       line[begin] == ')')) {
+            ++begin;
         }
-        return message.str();
+    }
+    if (begin == std::string_view::npos) {
+        return line;
     }
     
-    return line; // 파싱 실패시 원본 반환
+    std::string_view message = trimmedFrom(line, begin);
+    return message.empty() ? line : message; // 메시지가 없으면 원본 반환
 }
 
 std::string LogParser::logLevelToString(LogLevel level) {
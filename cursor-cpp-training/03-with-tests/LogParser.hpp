@@ -1,13 +1,20 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
-#include <regex>
-#include <unordered_map>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include "LineBatch.hpp"
+#include "ThreadPool.hpp"
 
 namespace LogAnalyzer {
 
-enum class LogLevel {
+enum class LogLevel : std::uint8_t {
     UNKNOWN = 0,
     ERROR = 1,
     WARNING = 2,
@@ -16,47 +23,240 @@ enum class LogLevel {
 };
 
 struct LogEntry {
+    // 타임스탬프가 없거나 달력상 올바르지 않은 날짜일 때의 epochMs
+    static constexpr std::int64_t NO_EPOCH = std::numeric_limits<std::int64_t>::min();
+    
     std::string originalLine;
     LogLevel level;
     std::string timestamp;
     std::string message;
+    std::int64_t epochMs;  // timestamp 를 UTC 로 본 에포크 밀리초 (시간 범위/정렬/구간 집계용)
+    
+    LogEntry() : level(LogLevel::UNKNOWN), epochMs(NO_EPOCH) {}
     
     LogEntry(const std::string& line, LogLevel lvl, 
-             const std::string& ts = "", const std::string& msg = "")
-        : originalLine(line), level(lvl), timestamp(ts), message(msg) {}
+             const std::string& ts = "", const std::string& msg = "",
+             std::int64_t epoch = NO_EPOCH)
+        : originalLine(line), level(lvl), timestamp(ts), message(msg), epochMs(epoch) {}
+    
+    bool hasEpoch() const noexcept { return epochMs != NO_EPOCH; }
+};
+
+// 공유 라인 버퍼 안의 위치만 담는 엔트리 (문자열은 출력할 때 CompactLogBatch 에서 꺼냄)
+// 라인 길이는 4GiB 미만이어야 함
+struct CompactLogEntry {
+    std::int64_t epochMs = LogEntry::NO_EPOCH;
+    std::uint64_t lineOffset = 0;     // 묶음의 바이트 공간에서 라인 시작
+    std::uint32_t lineLength = 0;
+    std::uint32_t messageOffset = 0;  // 라인 시작 기준
+    std::uint32_t messageLength = 0;
+    LogLevel level = LogLevel::UNKNOWN;
+    
+    bool hasEpoch() const noexcept { return epochMs != LogEntry::NO_EPOCH; }
+};
+
+static_assert(sizeof(CompactLogEntry) <= 32, "CompactLogEntry 는 32바이트 이하여야 함");
+
+// 라인 바이트 버퍼들과 그 안을 가리키는 CompactLogEntry 목록
+// 버퍼는 shared_ptr 로 공유되므로 묶음을 복사하거나 거르거나 이어 붙여도 라인 바이트는 복사되지 않음
+class CompactLogBatch {
+public:
+    std::size_t size() const noexcept { return entries_.size(); }
+    bool empty() const noexcept { return entries_.empty(); }
+    const CompactLogEntry& operator[](std::size_t i) const noexcept { return entries_[i]; }
+    std::vector<CompactLogEntry>::const_iterator begin() const noexcept { return entries_.begin(); }
+    std::vector<CompactLogEntry>::const_iterator end() const noexcept { return entries_.end(); }
+    
+    // 엔트리가 가리키는 원본 라인/메시지/타임스탬프 (묶음이 살아있는 동안 유효)
+    std::string_view line(const CompactLogEntry& entry) const noexcept;
+    std::string_view message(const CompactLogEntry& entry) const noexcept;
+    std::string_view timestamp(const CompactLogEntry& entry) const noexcept;
+    
+    // 출력용 LogEntry (이때만 문자열을 복사)
+    LogEntry materialize(const CompactLogEntry& entry) const;
+    
+    // 조건에 맞는 엔트리만 담은 묶음 (버퍼는 공유)
+    CompactLogBatch filter(const std::function<bool(const CompactLogEntry&)>& predicate) const;
+    
+    // 조건에 맞지 않는 엔트리를 제자리에서 지움 (새 묶음을 만들지 않음)
+    void retain(const std::function<bool(const CompactLogEntry&)>& predicate);
+    
+    // other 의 엔트리를 순서대로 뒤에 붙임 (other 의 버퍼를 넘겨받고 other 는 비움)
+    void append(CompactLogBatch&& other);
+
+private:
+    friend class LogParser;
+    
+    // base 부터 bytes 크기만큼의 바이트 공간
+    struct Segment {
+        std::uint64_t base;
+        std::shared_ptr<const std::string> bytes;
+    };
+    
+    std::vector<Segment> segments_;   // base 오름차순
+    std::uint64_t byteSize_ = 0;      // 다음에 붙일 버퍼의 base
+    std::vector<CompactLogEntry> entries_;
+};
+
+// 라인 묶음을 열(column) 단위로 파싱한 결과
+// 레벨/시각 집계는 levels/epochMs 연속 배열만 훑으면 되므로 문자열과 섞인 LogEntry 배열보다 캐시 효율이 좋고 벡터화가 쉬움
+// 오프셋은 파싱한 LineBatch::bytes() 기준이며 그 LineBatch 가 바뀌기 전까지 유효
+struct ParsedBatch {
+    std::vector<LogLevel> levels;
+    std::vector<std::int64_t> epochMs;       // 타임스탬프가 없으면 LogEntry::NO_EPOCH
+    std::vector<std::uint64_t> lineOffset;   // size() + 1 개, 라인 i 는 [lineOffset[i], lineOffset[i + 1])
+    std::vector<std::uint64_t> msgOffset;    // 메시지 시작 (라인 시작과 같으면 라인 전체가 메시지)
+    
+    std::size_t size() const noexcept { return levels.size(); }
+    bool empty() const noexcept { return levels.empty(); }
+    
+    // 용량은 유지하므로 같은 묶음을 반복해서 넘기면 재할당이 생기지 않음
+    void clear() noexcept {
+        levels.clear();
+        epochMs.clear();
+        lineOffset.clear();
+        msgOffset.clear();
+    }
+    
+    void resize(std::size_t count) {
+        levels.resize(count);
+        epochMs.resize(count);
+        lineOffset.resize(count + 1);
+        msgOffset.resize(count);
+    }
+    
+    // bytes 는 파싱한 LineBatch::bytes()
+    std::string_view line(std::string_view bytes, std::size_t i) const noexcept {
+        return bytes.substr(lineOffset[i], lineOffset[i + 1] - lineOffset[i]);
+    }
+    
+    // 메시지는 앞뒤 공백을 뺀 라인 끝까지이므로 끝 위치는 저장하지 않고 다시 계산
+    std::string_view message(std::string_view bytes, std::size_t i) const noexcept;
 };
 
 class LogParser {
 public:
+    // parseLine 호출 중 "날짜 시각 레벨 메시지" 고정 위치 빠른 경로로 처리된 비율
+    struct FastPathStats {
+        std::uint64_t lines = 0;
+        std::uint64_t hits = 0;
+        
+        double hitRate() const noexcept {
+            return lines == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lines);
+        }
+    };
+    
     LogParser();
     ~LogParser() = default;
+    
+    // 복사/이동 허용 (빠른 경로 통계는 그 시점의 값을 옮김)
+    LogParser(const LogParser& other) noexcept;
+    LogParser& operator=(const LogParser& other) noexcept;
+    LogParser(LogParser&& other) noexcept;
+    LogParser& operator=(LogParser&& other) noexcept;
 
     // 단일 라인 파싱
+    // "YYYY-MM-DD HH:MM:SS LEVEL 메시지" 형태는 고정 위치만 확인해 한 번에 채우고, 아니면 일반 탐색으로 처리
     LogEntry parseLine(const std::string& line) const;
     
     // 여러 라인 파싱
     std::vector<LogEntry> parseLines(const std::vector<std::string>& lines) const;
     
+    // 라인들을 구간으로 나눠 pool 에서 병렬로 파싱 (결과는 미리 잡아 둔 자리에 채우므로 입력 순서 유지)
+    std::vector<LogEntry> parseLines(const std::vector<std::string>& lines, ThreadPool& pool) const;
+    
+    // lines 의 바이트 버퍼를 넘겨받아 그 안을 가리키는 CompactLogEntry 로 파싱 (lines 는 비워짐)
+    // 라인마다 문자열을 만들지 않으므로 메모리 사용량이 원본 바이트 크기 + 라인당 32바이트
+    CompactLogBatch parseCompact(LineBatch&& lines) const;
+    CompactLogBatch parseCompact(LineBatch&& lines, ThreadPool& pool) const;
+    
+    // lines 를 out 의 열 배열로 파싱 (out 의 기존 내용은 지우고 용량은 재사용)
+    void parseBatch(const LineBatch& lines, ParsedBatch& out) const;
+    void parseBatch(const LineBatch& lines, ParsedBatch& out, ThreadPool& pool) const;
+    
+    // 병렬 파싱에서 한 작업이 맡는 최소 라인 수 (이보다 적으면 나눠도 스레드 전환 비용이 더 큼)
+    static constexpr std::size_t PARALLEL_MIN_LINES = 4096;
+    
     // 키워드 검색
     std::vector<LogEntry> filterByKeyword(const std::vector<LogEntry>& entries, 
                                          const std::string& keyword) const;
+    CompactLogBatch filterByKeyword(const CompactLogBatch& entries, const std::string& keyword) const;
     
     // 로그 레벨별 필터링
     std::vector<LogEntry> filterByLevel(const std::vector<LogEntry>& entries, 
                                        LogLevel level) const;
+    CompactLogBatch filterByLevel(const CompactLogBatch& entries, LogLevel level) const;
+    
+    // 타임스탬프 "YYYY-MM-DD HH:MM:SS" 의 길이
+    static constexpr std::size_t TIMESTAMP_LENGTH = 19;
+    
+    // 라인에서 처음 나오는 타임스탬프의 시작 위치 (없으면 std::string_view::npos, 길이는 TIMESTAMP_LENGTH)
+    // 정규식 \d{4}-\d{2}-\d{2}\s\d{2}:\d{2}:\d{2} 와 같은 위치를 찾되 자리마다 숫자/구분자를 직접 검사
+    static std::size_t findTimestamp(std::string_view line) noexcept;
+    
+    // 라인에서 "YYYY-MM-DD HH:MM:SS" 타임스탬프만 추출 (없으면 빈 문자열)
+    std::string extractTimestamp(const std::string& line) const;
+    
+    // "YYYY-MM-DD HH:MM:SS" 를 UTC 로 본 에포크 밀리초 (형식이나 날짜가 틀리면 LogEntry::NO_EPOCH)
+    // 연속된 라인은 거의 같은 날짜/시각이므로 "YYYY-MM-DD HH" 앞부분별 결과를 스레드마다 기억해 두고
+    // 앞부분이 바뀔 때만 달력 계산을 함
+    static std::int64_t timestampToEpochMs(std::string_view timestamp) noexcept;
     
     // 로그 레벨 문자열 변환
     static std::string logLevelToString(LogLevel level);
     static LogLevel stringToLogLevel(const std::string& levelStr);
+    
+    // 지금까지 파싱한 라인 수와 빠른 경로 적중 수 (여러 스레드에서 함께 써도 안전)
+    FastPathStats fastPathStats() const noexcept;
+    void resetFastPathStats() noexcept;
 
 private:
-    std::unordered_map<std::string, LogLevel> levelMap_;
-    std::regex timestampRegex_;
+    // 여러 스레드가 라인마다 갱신하므로 두 카운터가 한 캐시 라인을 번갈아 뺏지 않도록 각각 64바이트 경계에 둠
+    struct alignas(64) PaddedCounter {
+        std::atomic<std::uint64_t> value{0};
+    };
     
-    void initializeLevelMap();
-    LogLevel detectLogLevel(const std::string& line) const;
-    std::string extractTimestamp(const std::string& line) const;
-    std::string extractMessage(const std::string& line) const;
+    mutable PaddedCounter parsedLines_;
+    mutable PaddedCounter fastPathHits_;
+    
+    // 한 라인의 파싱 결과 (원본 라인 안의 위치)
+    struct LineFields {
+        LogLevel level = LogLevel::UNKNOWN;
+        std::string_view timestamp;
+        std::string_view message;
+        std::int64_t epochMs = LogEntry::NO_EPOCH;
+    };
+    
+    // 카운터를 갱신하지 않는 파싱 본체 (fastPath 에 빠른 경로 적중 여부를 기록)
+    static LogEntry parseLine(const std::string& line, bool& fastPath);
+    static LineFields parseFields(std::string_view line, bool& fastPath) noexcept;
+    
+    // lines[begin, end) 를 out 부터 채움
+    void parseCompactRange(const LineBatch& lines, std::size_t begin, std::size_t end, CompactLogEntry* out) const;
+    static void adoptLineBuffer(CompactLogBatch& batch, LineBatch&& lines);
+    
+    // lines[begin, end) 를 out 의 같은 위치에 채움
+    void parseBatchRange(const LineBatch& lines, std::size_t begin, std::size_t end, ParsedBatch& out) const;
+    
+    // [0, count) 를 PARALLEL_MIN_LINES 이상씩의 구간으로 나눠 pool 에서 parseSlice 실행
+    static void forEachSlice(std::size_t count, ThreadPool& pool,
+                             const std::function<void(std::size_t begin, std::size_t end)>& parseSlice);
+    
+    void recordFastPath(std::uint64_t lines, std::uint64_t hits) const noexcept;
+    void copyFastPathStats(const LogParser& other) noexcept;
+    
+    // 라인 맨 앞이 "YYYY-MM-DD HH:MM:SS LEVEL 메시지" 형태일 때만 fields 를 채우고 true
+    static bool parseCanonicalFields(std::string_view line, LineFields& fields) noexcept;
+    
+    // 라인에서 처음 나오는 레벨 토큰 (대소문자 무시, 영문자 연속 구간 전체가 ERROR/ERR/WARN/WARNING/INFO/DEBUG/DBG 일 때만)
+    // 복사 없이 한 번만 훑으며, 레벨 단어의 첫 글자(E/W/I/D) 후보 위치를 SSE2 로 16바이트씩 찾음
+    // levelEnd 가 있으면 찾은 레벨 토큰이 끝나는 위치를 기록
+    static LogLevel detectLogLevel(std::string_view line, std::size_t* levelEnd = nullptr) noexcept;
+    
+    // 레벨 토큰 뒤 (레벨이 없으면 타임스탬프 뒤) 에서 앞뒤 공백을 뺀 구간을 원본 라인 안의 위치로 반환
+    // 둘 다 없거나 그 뒤가 비어 있으면 라인 전체 (없는 위치는 std::string_view::npos)
+    static std::string_view extractMessage(std::string_view line, std::size_t timestampEnd,
+                                           std::size_t levelEnd) noexcept;
 };
 
 } // namespace LogAnalyzer 
\ No newline at end of file
@@ -2,9 +2,95 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ctime>
+#include <array>
 
 namespace LogAnalyzer {
 
+namespace {
+
+// statsToJson 의 "logs" 배열 항목 하나
+void appendJsonLog(std::ostringstream& json, std::string_view timestamp, LogLevel level,
+                   std::string_view line, bool& first) {
+    if (!first) json << ",\n";
+    json << "    {\n";
+    json << "      \"timestamp\": \"" << timestamp << "\",\n";
+    json << "      \"level\": \"" << LogParser::logLevelToString(level) << "\",\n";
+    // JSON 문자열에 포함될 수 있는 특수 문자(따옴표, 역슬래시 등)를 이스케이프 처리합니다.
+    std::string escapedMessage;
+    escapedMessage.reserve(line.length());
+    for (char c : line) {
+        switch (c) {
+            case '\"': escapedMessage += "\\\""; break;
+            case '\\': escapedMessage += "\\\\"; break;
+            case '\b': escapedMessage += "\\b"; break;
+            case '\f': escapedMessage += "\\f"; break;
+            case '\n': escapedMessage += "\\n"; break;
+            case '\r': escapedMessage += "\\r"; break;
+            case '\t': escapedMessage += "\\t"; break;
+            default: escapedMessage += c; break;
+        }
+    }
+    json << "      \"message\": \"" << escapedMessage << "\"\n";
+    json << "    }";
+    first = false;
+}
+
+// 음수 시각도 간격 경계에 맞도록 내림 나눗셈
+std::int64_t floorToBucket(std::int64_t value, std::int64_t bucketMs) {
+    return (value / bucketMs - (value % bucketMs < 0 ? 1 : 0)) * bucketMs;
+}
+
+// epochAt(0) ~ epochAt(size - 1) 을 bucketMs 간격으로 센 결과 (LogStats::bucketByTime 설명 참고)
+// 열 배열과 엔트리 배열 모두 복사 없이 그대로 훑도록 접근 함수를 받음
+template <typename EpochAt>
+TimeHistogram bucketEpochs(std::size_t size, EpochAt epochAt, std::int64_t bucketMs) {
+    TimeHistogram histogram;
+    histogram.bucketMs = bucketMs;
+    if (bucketMs <= 0) {
+        return histogram;
+    }
+    
+    // NO_EPOCH 는 int64 최솟값이므로 최댓값 계산에는 그대로 두고 최솟값 계산에서만 제외
+    std::int64_t first = std::numeric_limits<std::int64_t>::max();
+    std::int64_t last = LogEntry::NO_EPOCH;
+    for (std::size_t i = 0; i < size; ++i) {
+        std::int64_t value = epochAt(i);
+        first = std::min(first, value == LogEntry::NO_EPOCH ? std::numeric_limits<std::int64_t>::max() : value);
+        last = std::max(last, value);
+    }
+    if (last == LogEntry::NO_EPOCH) {
+        return histogram;
+    }
+    
+    // 범위는 int64 를 넘을 수 있으므로 부호 없는 차로 계산
+    std::uint64_t span = static_cast<std::uint64_t>(last) - static_cast<std::uint64_t>(first);
+    std::uint64_t step = static_cast<std::uint64_t>(bucketMs);
+    if (span / step >= LogStats::MAX_TIME_BUCKETS - 1) {
+        // 시작을 내림 정렬해도 간격 수가 MAX_TIME_BUCKETS 이하가 되는 가장 작은 bucketMs 의 배수
+        std::uint64_t minimum = span / (LogStats::MAX_TIME_BUCKETS - 1) + 1;
+        step = (minimum + step - 1) / step * step;
+        histogram.bucketMs = static_cast<std::int64_t>(step);
+    }
+    
+    histogram.startMs = floorToBucket(first, histogram.bucketMs);
+    std::uint64_t base = static_cast<std::uint64_t>(histogram.startMs);
+    histogram.counts.assign(static_cast<std::size_t>((static_cast<std::uint64_t>(last) - base) / step) + 1, 0);
+    for (std::size_t i = 0; i < size; ++i) {
+        std::int64_t value = epochAt(i);
+        if (value != LogEntry::NO_EPOCH) {
+            histogram.counts[static_cast<std::size_t>((static_cast<std::uint64_t>(value) - base) / step)]++;
+        }
+    }
+    
+    return histogram;
+}
+
+} // namespace
+
 Statistics LogStats::calculateStats(const std::vector<LogEntry>& entries, 
                                    const std::string& filePath, 
                                    std::uintmax_t fileSize) {
@@ -22,17 +108,154 @@ Statistics LogStats::calculateStats(const std::vector<LogEntry>& entries,
     return stats;
 }
 
+Statistics LogStats::calculateStats(CompactLogBatch entries, const std::string& filePath, std::uintmax_t fileSize) {
+    Statistics stats;
+    stats.filePath = filePath;
+    stats.fileSize = fileSize;
+    stats.totalLines = entries.size();
+    
+    // 엔트리 배열을 한 번 훑어 고정 크기 배열에 레벨별로 셈 (열로 옮겨 담지 않음)
+    std::array<std::size_t, static_cast<std::size_t>(LogLevel::DEBUG) + 1> levelCounts {};
+    for (const auto& entry : entries) {
+        levelCounts[static_cast<std::size_t>(entry.level)]++;
+    }
+    for (std::size_t i = 0; i < levelCounts.size(); ++i) {
+        if (levelCounts[i] > 0) {
+            stats.levelCounts[static_cast<LogLevel>(i)] = levelCounts[i];
+        }
+    }
+    stats.timeline = bucketEpochs(entries.size(), [&entries](std::size_t i) { return entries[i].epochMs; },
+                                  TIMELINE_BUCKET_MS);
+    
+    // 라인 버퍼는 공유하고 엔트리 목록은 넘겨받으므로 복사 없음
+    stats.compactEntries = std::move(entries);
+    return stats;
+}
+
+std::unordered_map<LogLevel, std::size_t> LogStats::countLevels(const ParsedBatch& batch) const {
+    std::unordered_map<LogLevel, std::size_t> levelCounts;
+    
+    // 분기 없는 비교/합산 루프를 레벨마다 한 번씩 (1바이트 배열이라 여러 번 훑어도 라인당 비용이 작음)
+    const LogLevel* levels = batch.levels.data();
+    std::size_t size = batch.levels.size();
+    for (int i = 0; i <= static_cast<int>(LogLevel::DEBUG); ++i) {
+        LogLevel level = static_cast<LogLevel>(i);
+        std::size_t count = 0;
+        for (std::size_t j = 0; j < size; ++j) {
+            count += levels[j] == level;
+        }
+        if (count > 0) {
+            levelCounts[level] = count;
+        }
+    }
+    
+    return levelCounts;
+}
+
+TimeHistogram LogStats::bucketByTime(const ParsedBatch& batch, std::int64_t bucketMs) const {
+    const std::int64_t* epochMs = batch.epochMs.data();
+    return bucketEpochs(batch.epochMs.size(), [epochMs](std::size_t i) { return epochMs[i]; }, bucketMs);
+}
+
+Statistics LogStats::calculateSampledStats(const std::vector<BlockCounts>& blocks,
+                                          std::uintmax_t sampledBytes,
+                                          std::size_t populationBlocks,
+                                          const std::string& filePath,
+                                          std::uintmax_t fileSize) const {
+    Statistics stats;
+    stats.filePath = filePath;
+    stats.fileSize = fileSize;
+
+    SamplingInfo sampling;
+    sampling.blockCount = blocks.size();
+    sampling.byteFraction = fileSize > 0 ? static_cast<double>(sampledBytes) / static_cast<double>(fileSize) : 1.0;
+
+    std::unordered_map<LogLevel, std::size_t> sampledCounts;
+    for (const auto& block : blocks) {
+        sampling.sampledLines += block.lines;
+        for (const auto& [level, count] : block.levelCounts) {
+            sampledCounts[level] += count;
+        }
+    }
+
+    // 읽은 바이트 비율로 전체를 환산 (비율 추정)
+    double scale = sampledBytes > 0 ? static_cast<double>(fileSize) / static_cast<double>(sampledBytes) : 0.0;
+    stats.totalLines = static_cast<std::size_t>(std::llround(sampling.sampledLines * scale));
+
+    // 조건에 맞는 라인이 하나도 없으면 비율을 정할 수 없으므로 개수와 오차 모두 0
+    if (sampling.sampledLines == 0) {
+        stats.sampling = std::move(sampling);
+        return stats;
+    }
+
+    // 블록 안의 라인끼리는 비슷하므로 블록 간 분산으로 비율의 분산을 추정하고 유한 모집단 보정을 적용
+    std::size_t k = blocks.size();
+    double finiteCorrection = populationBlocks > 0 ? 1.0 - static_cast<double>(k) / static_cast<double>(populationBlocks) : 0.0;
+    double meanLines = k > 0 ? static_cast<double>(sampling.sampledLines) / static_cast<double>(k) : 0.0;
+
+    for (const auto& [level, count] : sampledCounts) {
+        stats.levelCounts[level] = static_cast<std::size_t>(std::llround(count * scale));
+
+        double proportion = static_cast<double>(count) / static_cast<double>(sampling.sampledLines);
+        double variance = 0.0;
+        if (k >= 2 && meanLines > 0.0) {
+            double sumSquares = 0.0;
+            for (const auto& block : blocks) {
+                auto it = block.levelCounts.find(level);
+                double blockCount = it != block.levelCounts.end() ? static_cast<double>(it->second) : 0.0;
+                double residual = blockCount - proportion * static_cast<double>(block.lines);
+                sumSquares += residual * residual;
+            }
+            variance = finiteCorrection * sumSquares / (static_cast<double>(k - 1) * k * meanLines * meanLines);
+        } else {
+            // 블록이 하나뿐이면 라인을 독립 표본으로 보는 근사
+            variance = finiteCorrection * proportion * (1.0 - proportion) / static_cast<double>(sampling.sampledLines);
+        }
+        sampling.marginOfError[level] = 1.96 * std::sqrt(std::max(variance, 0.0)) * 100.0;
+    }
+
+    stats.sampling = std::move(sampling);
+    return stats;
+}
+
+void LogStats::updateStats(Statistics& stats, const LogEntry& entry) const {
+    stats.totalLines++;
+    stats.levelCounts[entry.level]++;
+    stats.analysisTime = std::chrono::system_clock::now();
+}
+
 void LogStats::printStats(const Statistics& stats) const {
     std::cout << "\n=== 로그 분석 결과 ===\n";
     std::cout << "파일 경로: " << stats.filePath << "\n";
-    std::cout << "파일 크기: " << formatFileSize(stats.fileSize) << "\n";
-    std::cout << "전체 라인 수: " << stats.totalLines << "\n";
+    if (stats.fileSizeKnown) {
+        std::cout << "파일 크기: " << formatFileSize(stats.fileSize) << "\n";
+    } else {
+        std::cout << "읽은 크기: " << formatFileSize(stats.fileSize) << " (스트림 입력)\n";
+    }
+    if (stats.sampling) {
+        // 표본에서 환산한 추정값과 95% 신뢰구간
+        std::cout << "표본 분석: 전체의 " << std::fixed << std::setprecision(2) << stats.sampling->byteFraction * 100.0
+                  << "% (블록 " << stats.sampling->blockCount << "개, 라인 " << stats.sampling->sampledLines
+                  << "개), 개수는 추정값\n";
+        std::cout << "전체 라인 수: ~" << stats.totalLines << "\n";
+        if (stats.sampling->sampledLines == 0) {
+            std::cout << "표본에서 조건에 맞는 라인이 없습니다\n";
+        }
+    } else {
+        std::cout << "전체 라인 수: " << stats.totalLines << "\n";
+    }
     
     for (const auto& [level, count] : stats.levelCounts) {
         if (count > 0) {
-            std::cout << LogParser::logLevelToString(level) << " 개수: " 
+            std::cout << LogParser::logLevelToString(level) << " 개수: " << (stats.sampling ? "~" : "")
                      << count << " (" << std::fixed << std::setprecision(1) 
-                     << calculatePercentage(count, stats.totalLines) << "%)\n";
+                     << calculatePercentage(count, stats.totalLines) << "%";
+            if (stats.sampling) {
+                auto it = stats.sampling->marginOfError.find(level);
+                double margin = it != stats.sampling->marginOfError.end() ? it->second : 0.0;
+                std::cout << " ±" << std::setprecision(2) << margin << "%p";
+            }
+            std::cout << ")\n";
         }
     }
     
@@ -70,6 +293,18 @@ void LogStats::printDetailedStats(const Statistics& stats) const {
             std::cout << "\n";
         }
     }
+    
+    if (!stats.timeline.counts.empty()) {
+        const auto& counts = stats.timeline.counts;
+        std::size_t peak = static_cast<std::size_t>(std::max_element(counts.begin(), counts.end()) - counts.begin());
+        std::int64_t lastStart = stats.timeline.startMs + static_cast<std::int64_t>(counts.size() - 1) * stats.timeline.bucketMs;
+        std::cout << "\n=== 시간대별 라인 수 (" << stats.timeline.bucketMs / 1000 << "초 간격) ===\n";
+        std::cout << "구간: " << formatEpochMs(stats.timeline.startMs) << " ~ " << formatEpochMs(lastStart)
+                  << " (" << counts.size() << "개)\n";
+        std::cout << "가장 많은 구간: "
+                  << formatEpochMs(stats.timeline.startMs + static_cast<std::int64_t>(peak) * stats.timeline.bucketMs)
+                  << " (" << counts[peak] << " 라인)\n";
+    }
 }
 
 std::string LogStats::statsToJson(const Statistics& stats) const {
@@ -78,6 +313,7 @@ std::string LogStats::statsToJson(const Statistics& stats) const {
     json << "{\n";
     json << "  \"filePath\": \"" << stats.filePath << "\",\n";
     json << "  \"fileSize\": " << stats.fileSize << ",\n";
+    json << "  \"fileSizeKnown\": " << (stats.fileSizeKnown ? "true" : "false") << ",\n";
     json << "  \"totalLines\": " << stats.totalLines << ",\n";
     json << "  \"analysisTime\": \"" << formatTimestamp(stats.analysisTime) << "\",\n";
     json << "  \"levelCounts\": {\n";
@@ -94,33 +330,35 @@ std::string LogStats::statsToJson(const Statistics& stats) const {
     }
     
     json << "\n  },\n";
+    
+    if (stats.sampling) {
+        // 개수는 추정값, marginOfError 는 레벨 비율(%p)의 95% 신뢰구간 반폭
+        json << "  \"sampling\": {\n";
+        json << "    \"byteFraction\": " << std::setprecision(6) << stats.sampling->byteFraction << ",\n";
+        json << "    \"blockCount\": " << stats.sampling->blockCount << ",\n";
+        json << "    \"sampledLines\": " << stats.sampling->sampledLines << ",\n";
+        json << "    \"marginOfError\": {\n" << std::setprecision(2);
+        first = true;
+        for (int i = 0; i <= static_cast<int>(LogLevel::DEBUG); ++i) {
+            LogLevel level = static_cast<LogLevel>(i);
+            auto it = stats.sampling->marginOfError.find(level);
+            if (!first) json << ",\n";
+            json << "      \"" << LogParser::logLevelToString(level) << "\": "
+                 << (it != stats.sampling->marginOfError.end() ? it->second : 0.0);
+            first = false;
+        }
+        json << "\n    }\n";
+        json << "  },\n" << std::setprecision(1);
+    }
+    
     json << "  \"logs\": [\n";
 
     first = true;
     for (const auto& entry : stats.entries) {
-        if (!first) json << ",\n";
-        json << "    {\n";
-        json << "      \"timestamp\": \"" << entry.timestamp << "\",\n";
-        json << "      \"level\": \"" << LogParser::logLevelToString(entry.level) << "\",\n";
-        // JSON 문자열에 포함될 수 있는 특수 문자(따옴표, 역슬래시 등)를 이스케이프 처리합니다.
-        std::string message = entry.originalLine;
-        std::string escapedMessage;
-        escapedMessage.reserve(message.length());
-        for (char c : message) {
-            switch (c) {
-                case '\"': escapedMessage += "\\\""; break;
-                case '\\': escapedMessage += "\\\\"; break;
-                case '\b': escapedMessage += "\\b"; break;
-                case '\f': escapedMessage += "\\f"; break;
-                case '\n': escapedMessage += "\\n"; break;
-                case '\r': escapedMessage += "\\r"; break;
-                case '\t': escapedMessage += "\\t"; break;
-                default: escapedMessage += c; break;
-            }
-        }
-        json << "      \"message\": \"" << escapedMessage << "\"\n";
-        json << "    }";
-        first = false;
+        appendJsonLog(json, entry.timestamp, entry.level, entry.originalLine, first);
+    }
+    for (const auto& entry : stats.compactEntries) {
+        appendJsonLog(json, stats.compactEntries.timestamp(entry), entry.level, stats.compactEntries.line(entry), first);
     }
 
     json << "\n  ]\n";
@@ -146,6 +384,23 @@ void LogStats::printEntriesByLevel(const std::vector<LogEntry>& entries, LogLeve
     }
 }
 
+void LogStats::printEntriesByLevel(const CompactLogBatch& entries, LogLevel level) const {
+    std::cout << "\n=== " << LogParser::logLevelToString(level) << " 로그 엔트리 ===\n";
+    
+    std::size_t count = 0;
+    for (const auto& entry : entries) {
+        if (entry.level == level) {
+            std::cout << "[" << ++count << "] " << entries.line(entry) << "\n";
+        }
+    }
+    
+    if (count == 0) {
+        std::cout << "해당 레벨의 로그가 없습니다.\n";
+    } else {
+        std::cout << "총 " << count << "개의 " << LogParser::logLevelToString(level) << " 로그를 발견했습니다.\n";
+    }
+}
+
 void LogStats::printKeywordMatches(const std::vector<LogEntry>& entries, 
                                  const std::string& keyword) const {
     std::cout << "\n=== 키워드 '" << keyword << "' 검색 결과 ===\n";
@@ -165,6 +420,24 @@ void LogStats::printKeywordMatches(const std::vector<LogEntry>& entries,
     }
 }
 
+void LogStats::printKeywordMatches(const CompactLogBatch& entries, const std::string& keyword) const {
+    std::cout << "\n=== 키워드 '" << keyword << "' 검색 결과 ===\n";
+    
+    std::size_t count = 0;
+    for (const auto& entry : entries) {
+        std::string_view line = entries.line(entry);
+        if (line.find(keyword) != std::string_view::npos) {
+            std::cout << "[" << ++count << "] [" << LogParser::logLevelToString(entry.level) << "] " << line << "\n";
+        }
+    }
+    
+    if (count == 0) {
+        std::cout << "키워드를 포함한 로그가 없습니다.\n";
+    } else {
+        std::cout << "총 " << count << "개의 매칭 로그를 발견했습니다.\n";
+    }
+}
+
 std::string LogStats::formatTimestamp(const std::chrono::system_clock::time_point& timePoint) const {
     auto time_t = std::chrono::system_clock::to_time_t(timePoint);
     std::ostringstream oss;
@@ -172,6 +445,16 @@ std::string LogStats::formatTimestamp(const std::chrono::system_clock::time_poin
     return oss.str();
 }
 
+std::string LogStats::formatEpochMs(std::int64_t epochMs) const {
+    // epochMs 는 로그의 타임스탬프를 UTC 로 본 값이므로 UTC 로 되돌리면 로그에 적힌 시각 그대로
+    std::time_t seconds = static_cast<std::time_t>(floorToBucket(epochMs, 1000) / 1000);
+    std::tm parts {};
+    gmtime_r(&seconds, &parts);
+    std::ostringstream oss;
+    oss << std::put_time(&parts, "%Y-%m-%d %H:%M");
+    return oss.str();
+}
+
 std::string LogStats::formatFileSize(std::uintmax_t size) const {
     const char* units[] = {"B", "KB", "MB", "GB"};
     double fileSize = static_cast<double>(size);
@@ -5,16 +5,45 @@
 #include <chrono>
 #include <string>
 #include <vector>
+#include <optional>
+#include <cstdint>
 
 namespace LogAnalyzer {
 
+// 표본 분석(--sample) 정보, 이때 Statistics 의 개수는 전체로 환산한 추정값
+struct SamplingInfo {
+    double byteFraction = 1.0;      // 읽은 바이트 / 전체 바이트
+    std::size_t blockCount = 0;     // 읽은 표본 블록 수
+    std::size_t sampledLines = 0;   // 실제로 읽은 라인 수
+    std::unordered_map<LogLevel, double> marginOfError;  // 레벨 비율(%p)의 95% 신뢰구간 반폭
+};
+
+// 표본 블록 하나에서 센 값
+struct BlockCounts {
+    std::size_t lines = 0;
+    std::unordered_map<LogLevel, std::size_t> levelCounts;
+};
+
+// 일정한 시간 간격별 라인 수 (counts[i] 는 [startMs + i * bucketMs, startMs + (i + 1) * bucketMs))
+struct TimeHistogram {
+    std::int64_t startMs = 0;
+    std::int64_t bucketMs = 0;
+    std::vector<std::size_t> counts;
+};
+
 struct Statistics {
     std::size_t totalLines = 0;
     std::unordered_map<LogLevel, std::size_t> levelCounts;
     std::chrono::system_clock::time_point analysisTime;
     std::string filePath;
     std::uintmax_t fileSize = 0;
+    bool fileSizeKnown = true;  // false 면 fileSize 는 스트림(표준 입력)에서 읽은 바이트 수
+    // 둘 중 하나만 채움: 병합/추적/체크포인트 경로는 라인마다 따로 만든 LogEntry 를 흘려보내므로 entries,
+    // 단일 파일 경로는 공유 라인 버퍼를 가리키는 compactEntries (출력할 때만 문자열을 꺼냄)
     std::vector<LogEntry> entries;
+    CompactLogBatch compactEntries;
+    std::optional<SamplingInfo> sampling;
+    TimeHistogram timeline;  // LogStats::TIMELINE_BUCKET_MS 간격 라인 수 (compactEntries 로 계산했을 때만 채움)
     
     Statistics() : analysisTime(std::chrono::system_clock::now()) {}
 };
@@ -29,6 +58,32 @@ public:
                             const std::string& filePath = "", 
                             std::uintmax_t fileSize = 0);
     
+    // 엔트리 목록을 넘겨받아 Statistics::compactEntries 에 보관 (라인 문자열을 만들지 않음)
+    // 레벨 개수와 timeline 은 엔트리 배열을 그대로 훑어 계산 (bucketByTime 과 같은 간격 규칙)
+    Statistics calculateStats(CompactLogBatch entries, const std::string& filePath, std::uintmax_t fileSize);
+    
+    // 무작위 표본 블록에서 센 값을 전체로 환산 (블록 단위 집락 표본으로 보고 신뢰구간 계산)
+    // populationBlocks 는 파일을 같은 크기로 나눴을 때의 전체 블록 수
+    Statistics calculateSampledStats(const std::vector<BlockCounts>& blocks,
+                                     std::uintmax_t sampledBytes,
+                                     std::size_t populationBlocks,
+                                     const std::string& filePath,
+                                     std::uintmax_t fileSize) const;
+    
+    // ParsedBatch 의 levels 열만 훑어 레벨별 개수 (레벨마다 한 번씩 비교/합산하는 단순 루프라 벡터화됨)
+    std::unordered_map<LogLevel, std::size_t> countLevels(const ParsedBatch& batch) const;
+    
+    // ParsedBatch 의 epochMs 열을 bucketMs 간격으로 나눠 센 결과 (타임스탬프 없는 라인은 제외)
+    // 시작은 가장 이른 시각이 속한 간격의 시작이며 counts 는 가장 늦은 시각까지의 간격 수만큼 (타임스탬프가 없으면 빈 배열)
+    // 동떨어진 시각 하나로 간격 수가 MAX_TIME_BUCKETS 를 넘으면 간격을 bucketMs 의 배수로 넓혀 그 안에 맞춤
+    TimeHistogram bucketByTime(const ParsedBatch& batch, std::int64_t bucketMs) const;
+    
+    static constexpr std::size_t MAX_TIME_BUCKETS = 1 << 20;
+    static constexpr std::int64_t TIMELINE_BUCKET_MS = 60 * 1000;
+    
+    // 새 엔트리 하나를 기존 통계에 반영 (follow 모드용, entries 에는 저장하지 않음)
+    void updateStats(Statistics& stats, const LogEntry& entry) const;
+    
     // 통계 출력
     void printStats(const Statistics& stats) const;
     void printDetailedStats(const Statistics& stats) const;
@@ -38,13 +93,16 @@ public:
     
     // 특정 레벨의 엔트리들 출력
     void printEntriesByLevel(const std::vector<LogEntry>& entries, LogLevel level) const;
+    void printEntriesByLevel(const CompactLogBatch& entries, LogLevel level) const;
     
     // 키워드 매칭 엔트리들 출력
     void printKeywordMatches(const std::vector<LogEntry>& entries, 
                            const std::string& keyword) const;
+    void printKeywordMatches(const CompactLogBatch& entries, const std::string& keyword) const;
 
 private:
     std::string formatTimestamp(const std::chrono::system_clock::time_point& timePoint) const;
+    std::string formatEpochMs(std::int64_t epochMs) const;
     std::string formatFileSize(std::uintmax_t size) const;
     double calculatePercentage(std::size_t count, std::size_t total) const;
 };
@@ -0,0 +1,96 @@
+#include "MappedFile.hpp"
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace LogAnalyzer {
+
+MappedFile::MappedFile(const std::string& filePath) {
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "메모리 매핑 실패: " << filePath << " (" << std::strerror(errno) << ")" << std::endl;
+        return;
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        std::cerr << "메모리 매핑 실패: " << filePath << " (" << std::strerror(errno) << ")" << std::endl;
+        ::close(fd);
+        return;
+    }
+
+    size_ = static_cast<std::size_t>(st.st_size);
+
+    // 빈 파일은 mmap 할 수 없으므로 빈 뷰로 처리
+    if (size_ > 0) {
+        void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            std::cerr << "메모리 매핑 실패: " << filePath << " (" << std::strerror(errno) << ")" << std::endl;
+            ::close(fd);
+            size_ = 0;
+            return;
+        }
+        data_ = static_cast<const char*>(addr);
+
+        // 순차 스캔이므로 커널에 적극적인 read-ahead 와 조기 페이지 회수를 요청
+        ::madvise(addr, size_, MADV_SEQUENTIAL);
+    }
+
+    // 매핑은 fd 를 닫아도 유지됨
+    ::close(fd);
+    isValid_ = true;
+}
+
+MappedFile::~MappedFile() {
+    unmap();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(other.data_), size_(other.size_), isValid_(other.isValid_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.isValid_ = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        data_ = other.data_;
+        size_ = other.size_;
+        isValid_ = other.isValid_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.isValid_ = false;
+    }
+    return *this;
+}
+
+bool MappedFile::isValid() const noexcept {
+    return isValid_;
+}
+
+std::string_view MappedFile::data() const noexcept {
+    if (data_ == nullptr) {
+        return {};
+    }
+    return std::string_view(data_, size_);
+}
+
+std::size_t MappedFile::size() const noexcept {
+    return size_;
+}
+
+void MappedFile::unmap() noexcept {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<char*>(data_), size_);
+        data_ = nullptr;
+    }
+    size_ = 0;
+    isValid_ = false;
+}
+
+} // namespace LogAnalyzer
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace LogAnalyzer {
+
+// 읽기 전용 메모리 매핑 파일 (RAII)
+// 매핑 영역은 페이지 캐시를 그대로 참조하므로 파일 크기만큼 힙을 사용하지 않음
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& filePath);
+    ~MappedFile();
+
+    // 매핑 영역은 하나의 소유자만 가짐
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool isValid() const noexcept;
+
+    // 매핑된 전체 내용 (빈 파일이면 빈 뷰)
+    std::string_view data() const noexcept;
+    std::size_t size() const noexcept;
+
+private:
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool isValid_ = false;
+
+    void unmap() noexcept;
+};
+
+} // namespace LogAnalyzer
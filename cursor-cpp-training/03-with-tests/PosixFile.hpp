@@ -0,0 +1,93 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+namespace LogAnalyzer {
+
+// POSIX 파일 디스크립터 RAII 래퍼
+class ScopedFd {
+public:
+    explicit ScopedFd(const std::string& path) : fd_(::open(path.c_str(), O_RDONLY)) {}
+    ~ScopedFd() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+    
+    ScopedFd(const ScopedFd&) = delete;
+    ScopedFd& operator=(const ScopedFd&) = delete;
+    
+    bool isOpen() const noexcept { return fd_ >= 0; }
+    int get() const noexcept { return fd_; }
+
+private:
+    int fd_;
+};
+
+// EINTR 재시도와 부분 읽기를 처리하는 pread, 실패 시 -1
+inline ssize_t preadFully(int fd, char* buffer, std::size_t length, std::uintmax_t offset) {
+    std::size_t total = 0;
+    while (total < length) {
+        ssize_t n = ::pread(fd, buffer + total, length - total, static_cast<off_t>(offset + total));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (n == 0) {
+            break;
+        }
+        total += static_cast<std::size_t>(n);
+    }
+    return static_cast<ssize_t>(total);
+}
+
+// path 옆의 고유한 임시 파일(mkstemp)에 다 쓴 뒤 rename 으로 교체
+// 여러 프로세스가 같은 path 를 동시에 써도 서로의 임시 파일을 덮어쓰지 않고, 읽는 쪽은 반쯤 쓴 파일을 보지 않음
+inline bool replaceFileContents(const std::string& path, const char* data, std::size_t length) {
+    std::string tempPath = path + ".XXXXXX";
+    int fd = ::mkstemp(tempPath.data());
+    if (fd < 0) {
+        return false;
+    }
+
+    // mkstemp 는 0600 으로 만드므로 일반 파일과 같은 권한으로 맞춤
+    bool ok = ::fchmod(fd, 0644) == 0;
+    std::size_t total = 0;
+    while (ok && total < length) {
+        ssize_t n = ::write(fd, data + total, length - total);
+        if (n < 0) {
+            ok = errno == EINTR;
+            continue;
+        }
+        total += static_cast<std::size_t>(n);
+    }
+    ok = ::close(fd) == 0 && ok;
+
+    if (!ok || std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        ::unlink(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+// 파일 내용 지문용 FNV-1a 64비트 해시 (암호학적 용도 아님), hash 로 이전 결과를 이어서 계산
+constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+
+inline std::uint64_t fnv1aHash(const char* data, std::size_t length, std::uint64_t hash = FNV_OFFSET_BASIS) {
+    for (std::size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+} // namespace LogAnalyzer
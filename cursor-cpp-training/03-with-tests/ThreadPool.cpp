@@ -0,0 +1,109 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace LogAnalyzer {
+
+namespace {
+
+// run() 한 번의 진행 상태 (늦게 시작한 작업 스레드가 참조할 수 있도록 shared_ptr 로 공유)
+struct RunState {
+    RunState(std::size_t count, const std::function<void(std::size_t)>& fn) : taskCount(count), task(fn) {}
+
+    std::size_t taskCount;
+    const std::function<void(std::size_t)>& task;
+    std::atomic<std::size_t> nextTask{0};
+    std::size_t finishedTasks = 0;
+    std::mutex mutex;
+    std::condition_variable done;
+
+    // 남은 작업을 하나씩 가져가 실행 (run() 이 끝난 뒤 시작하면 task 를 건드리지 않고 바로 반환)
+    void drain() {
+        std::size_t finished = 0;
+        for (std::size_t i = nextTask.fetch_add(1); i < taskCount; i = nextTask.fetch_add(1)) {
+            task(i);
+            ++finished;
+        }
+        if (finished > 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+            finishedTasks += finished;
+            if (finishedTasks == taskCount) {
+                done.notify_all();
+            }
+        }
+    }
+};
+
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers_.reserve(threadCount - 1);
+    for (std::size_t i = 1; i < threadCount; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    jobAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::shared(std::size_t threadCount) {
+    static ThreadPool pool(threadCount);
+    return pool;
+}
+
+void ThreadPool::run(std::size_t taskCount, const std::function<void(std::size_t)>& task) {
+    if (taskCount == 0) {
+        return;
+    }
+
+    auto state = std::make_shared<RunState>(taskCount, task);
+    std::size_t helpers = std::min(workers_.size(), taskCount - 1);
+    if (helpers > 0) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (std::size_t i = 0; i < helpers; ++i) {
+                jobs_.emplace_back([state]() { state->drain(); });
+            }
+        }
+        if (helpers == 1) {
+            jobAvailable_.notify_one();
+        } else {
+            jobAvailable_.notify_all();
+        }
+    }
+
+    state->drain();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&state]() { return state->finishedTasks == state->taskCount; });
+}
+
+void ThreadPool::workerLoop() {
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            jobAvailable_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+            if (jobs_.empty()) {
+                return;
+            }
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        job();
+    }
+}
+
+} // namespace LogAnalyzer
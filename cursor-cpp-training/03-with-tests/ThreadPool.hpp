@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+namespace LogAnalyzer {
+
+// 고정 개수의 작업 스레드를 한 번만 만들어 두고 여러 번의 병렬 처리에 재사용하는 풀
+// run() 을 부른 스레드도 작업을 함께 처리하므로 작업 스레드는 threadCount - 1 개
+class ThreadPool {
+public:
+    // threadCount 가 0 이면 하드웨어 스레드 수
+    explicit ThreadPool(std::size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // 호출 스레드를 포함한 병렬 처리 폭
+    std::size_t size() const noexcept { return workers_.size() + 1; }
+
+    // task(0) ~ task(taskCount - 1) 를 나눠 실행하고 모두 끝날 때까지 대기
+    // 작업 스레드가 모두 바쁘면 호출 스레드가 남은 것을 처리하므로 run() 안에서 다시 run() 을 불러도 멈추지 않음
+    void run(std::size_t taskCount, const std::function<void(std::size_t)>& task);
+
+    // 프로세스 공용 풀: 처음 호출할 때의 threadCount 로 한 번만 만들고 이후 인자는 무시 (0 이면 하드웨어 스레드 수)
+    static ThreadPool& shared(std::size_t threadCount = 0);
+
+private:
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> jobs_;
+    std::mutex mutex_;
+    std::condition_variable jobAvailable_;
+    bool stopping_ = false;
+
+    void workerLoop();
+};
+
+} // namespace LogAnalyzer
@@ -1,21 +1,709 @@
+#include "Checkpoint.hpp"
 #include "LogFileReader.hpp"
+#include "LogFollower.hpp"
+#include "LogMerger.hpp"
 #include "LogParser.hpp"
 #include "LogStats.hpp"
+#include "ThreadPool.hpp"
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <exception>
 #include <fstream>
+#include <thread>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <chrono>
+#include <csignal>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <filesystem>
+#include <atomic>
+#include <random>
+#include <iomanip>
+#include <sstream>
+#include <charconv>
 
 using namespace LogAnalyzer;
 
+namespace {
+
+// 단일 파일 분석에서 한 번에 읽어 파싱하는 라인 수 (묶음마다 라인 버퍼 하나)
+constexpr std::size_t COMPACT_BATCH_LINES = 64 * 1024;
+
+// 명령행 옵션
+struct Options {
+    std::vector<std::string> inputs;
+    std::string keyword;
+    std::string levelFilter;
+    std::string jsonOutputFile;
+    bool jsonOutput = false;
+    bool detailedOutput = false;
+    ReadMode readMode = ReadMode::Stream;
+    std::size_t threadCount = 1;
+    bool followMode = false;
+    std::string since;               // 비어 있으면 시작 제한 없음
+    std::string until;               // 비어 있으면 끝 제한 없음 (until 시각은 포함하지 않음)
+    std::size_t tailCount = 0;       // 0 이 아니면 조건에 맞는 마지막 N 개만 출력
+    std::string stateFile;           // 비어 있지 않으면 체크포인트 기반 증분 분석
+    std::size_t lineRangeStart = 0;  // 0 이면 라인 범위 출력 안 함
+    std::size_t lineRangeCount = 1;
+    double sampleFraction = 0.0;     // 0 이 아니면 이 비율만큼의 블록만 읽어 통계를 추정
+};
+
+// 부호 없는 10진 정수만 개수로 받음 ("-1" 처럼 음수를 넣으면 stoul 은 아주 큰 값으로 바꿔 버림)
+std::optional<std::size_t> parseCount(std::string_view text) {
+    std::size_t value = 0;
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (text.empty() || error != std::errc() || end != text.data() + text.size()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+// 순차 읽기가 입력 손상이나 I/O 오류로 끝났으면 알리고 종료 코드 1, 아니면 0
+int readExitCode(const LogFileReader& reader) {
+    if (!reader.hasReadError()) {
+        return 0;
+    }
+    std::cerr << "입력을 끝까지 읽지 못했습니다 (결과는 읽은 부분까지만 반영): " << reader.getFilePath() << std::endl;
+    return 1;
+}
+
+// --since/--until 시간 범위 판정 (타임스탬프 없는 라인은 직전 라인의 판정을 따름)
+class TimeWindowFilter {
+public:
+    explicit TimeWindowFilter(const Options& options)
+        : since_(options.since), until_(options.until), lastAccepted_(options.since.empty()) {}
+
+    bool isActive() const { return !since_.empty() || !until_.empty(); }
+
+    bool accept(const LogEntry& entry) {
+        return accept(std::string_view(entry.timestamp));
+    }
+
+    bool accept(std::string_view timestamp) {
+        if (!timestamp.empty()) {
+            lastAccepted_ = contains(timestamp);
+        }
+        return lastAccepted_;
+    }
+
+    // 타임스탬프가 있는 라인 하나의 판정 (앞 라인과 무관하므로 뒤에서부터 읽을 때도 씀)
+    bool contains(std::string_view timestamp) const {
+        return (since_.empty() || timestamp >= since_) && (until_.empty() || timestamp < until_);
+    }
+
+    // 첫 타임스탬프보다 앞에 있는 라인의 판정
+    bool acceptsLeadingLines() const { return since_.empty(); }
+
+private:
+    std::string since_;
+    std::string until_;
+    bool lastAccepted_;
+};
+
+// follow 모드 종료 요청 (SIGINT/SIGTERM)
+volatile std::sig_atomic_t stopRequested = 0;
+
+void handleStopSignal(int) {
+    stopRequested = 1;
+}
+
+// 옵션에 따라 통계를 JSON 파일/JSON/상세/기본 형태로 출력
+void reportStats(const LogStats& stats, const Statistics& statistics, const Options& options) {
+    if (!options.jsonOutputFile.empty()) {
+        std::ofstream outFile(options.jsonOutputFile);
+        if (outFile) {
+            outFile << stats.statsToJson(statistics);
+            std::cout << "\n분석 결과를 " << options.jsonOutputFile << " 파일에 저장했습니다." << std::endl;
+        } else {
+            std::cerr << "JSON 파일을 열 수 없습니다: " << options.jsonOutputFile << std::endl;
+        }
+    } else if (options.jsonOutput) {
+        std::cout << stats.statsToJson(statistics) << std::endl;
+    } else if (options.detailedOutput) {
+        stats.printDetailedStats(statistics);
+    } else {
+        stats.printStats(statistics);
+    }
+}
+
+// 파일을 tail -f 처럼 따라가며 새 라인만 파싱해 통계를 누적
+int runFollowMode(const std::string& filePath, const Options& options) {
+    LogFollower follower(filePath);
+    if (!follower.isValid()) {
+        std::cerr << "파일을 읽을 수 없습니다: " << filePath << std::endl;
+        return 1;
+    }
+
+    std::signal(SIGINT, handleStopSignal);
+    std::signal(SIGTERM, handleStopSignal);
+
+    LogParser parser;
+    LogStats stats;
+    Statistics statistics;
+    statistics.filePath = filePath;
+
+    LogLevel levelToShow = options.levelFilter.empty() ? LogLevel::ERROR
+                                                       : LogParser::stringToLogLevel(options.levelFilter);
+    bool caughtUp = false;
+
+    std::cout << "로그 파일 추적 시작: " << filePath << " (Ctrl+C 로 종료)" << std::endl;
+
+    std::size_t rotationCount = 0;
+
+    while (!stopRequested) {
+        auto lines = follower.readAvailableLines();
+        if (follower.getRotationCount() != rotationCount) {
+            rotationCount = follower.getRotationCount();
+            std::cout << "로그 로테이션 감지: " << filePath << " 을(를) 처음부터 다시 따라갑니다" << std::endl;
+        }
+        for (const auto& line : lines) {
+            LogEntry entry = parser.parseLine(line);
+            stats.updateStats(statistics, entry);
+
+            // 기존 내용을 따라잡은 뒤부터 새로 들어온 관심 라인을 즉시 출력
+            bool matches = options.keyword.empty() ? entry.level == levelToShow
+                                                   : line.find(options.keyword) != std::string::npos;
+            if (caughtUp && matches) {
+                std::cout << "[" << LogParser::logLevelToString(entry.level) << "] " << line << "\n";
+            }
+        }
+
+        std::error_code ec;
+        statistics.fileSize = std::filesystem::file_size(filePath, ec);
+
+        if (!caughtUp) {
+            caughtUp = true;
+            stats.printStats(statistics);
+        } else if (!lines.empty()) {
+            std::cout << "+" << lines.size() << " 라인 (전체 " << statistics.totalLines << " 라인)" << std::endl;
+        }
+
+        follower.waitForChanges(std::chrono::milliseconds(500));
+    }
+
+    if (options.detailedOutput) {
+        stats.printDetailedStats(statistics);
+    } else {
+        stats.printStats(statistics);
+    }
+
+    return 0;
+}
+
+// 엔트리를 하나씩 받아 필터링과 집계를 동시에 수행
+// JSON 출력이 아니면 엔트리를 모두 보관하지 않고 출력할 엔트리만 모음
+void analyzeEntryStream(const std::function<std::optional<LogEntry>()>& nextEntry,
+                        Statistics& statistics, const Options& options) {
+    LogLevel levelFilter = LogLevel::UNKNOWN;
+    if (!options.levelFilter.empty()) {
+        levelFilter = LogParser::stringToLogLevel(options.levelFilter);
+        if (levelFilter == LogLevel::UNKNOWN) {
+            std::cerr << "알 수 없는 로그 레벨: " << options.levelFilter << std::endl;
+        }
+    }
+
+    bool keepAllEntries = options.jsonOutput || !options.jsonOutputFile.empty();
+    LogLevel levelToShow = levelFilter != LogLevel::UNKNOWN ? levelFilter : LogLevel::ERROR;
+
+    LogStats stats;
+    TimeWindowFilter window(options);
+    std::size_t readLines = 0;
+    std::vector<LogEntry> shownEntries;
+    while (auto entry = nextEntry()) {
+        ++readLines;
+        if (!window.accept(*entry)) {
+            continue;
+        }
+        if (!options.keyword.empty() && entry->originalLine.find(options.keyword) == std::string::npos) {
+            continue;
+        }
+        if (levelFilter != LogLevel::UNKNOWN && entry->level != levelFilter) {
+            continue;
+        }
+
+        stats.updateStats(statistics, *entry);
+        if (keepAllEntries) {
+            statistics.entries.push_back(std::move(*entry));
+        } else if (!options.keyword.empty() || entry->level == levelToShow) {
+            shownEntries.push_back(std::move(*entry));
+        }
+    }
+
+    std::cout << "읽은 라인 수: " << readLines << std::endl;
+
+    reportStats(stats, statistics, options);
+
+    const auto& entries = keepAllEntries ? statistics.entries : shownEntries;
+    if (!options.keyword.empty()) {
+        stats.printKeywordMatches(entries, options.keyword);
+    } else if (levelFilter != LogLevel::UNKNOWN || !entries.empty()) {
+        stats.printEntriesByLevel(entries, levelToShow);
+    }
+}
+
+// 여러 파일을 타임스탬프 순으로 병합하며 한 번에 분석
+int runMergeMode(const std::vector<std::string>& files, const Options& options) {
+    std::cout << "로그 파일 " << files.size() << "개 병합 분석 시작" << std::endl;
+
+    LogMerger merger(files);
+    if (!merger.isValid()) {
+        std::cerr << "읽을 수 있는 파일이 없습니다" << std::endl;
+        return 1;
+    }
+
+    Statistics statistics;
+    statistics.fileSize = merger.getTotalFileSize();
+    for (const auto& file : files) {
+        statistics.filePath += (statistics.filePath.empty() ? "" : ", ") + file;
+    }
+    std::cout << "파일 크기: " << statistics.fileSize << " bytes" << std::endl;
+
+    analyzeEntryStream([&merger]() { return merger.next(); }, statistics, options);
+    return merger.hasErrors() ? 1 : 0;
+}
+
+// 표준 입력(파이프)을 끝까지 스트리밍하며 분석 (전체 크기는 다 읽은 뒤에야 알 수 있음)
+int runStdinMode(const Options& options) {
+    std::cout << "표준 입력 분석 시작" << std::endl;
+
+    LogFileReader reader(LogFileReader::STDIN_PATH);
+    LogParser parser;
+    std::string line;
+
+    Statistics statistics;
+    statistics.filePath = "(표준 입력)";
+    statistics.fileSizeKnown = false;
+
+    analyzeEntryStream([&]() -> std::optional<LogEntry> {
+        auto view = reader.readNextLineView();
+        if (!view) {
+            // 스트림이 끝나면 읽은 양을 크기로 보고
+            statistics.fileSize = reader.getFileSize();
+            return std::nullopt;
+        }
+        line.assign(view->data(), view->size());
+        return parser.parseLine(line);
+    }, statistics, options);
+    return readExitCode(reader);
+}
+
+// 체크포인트 이후 추가된 부분만 분석하고 누적 통계를 보고 (cron 반복 실행용)
+int runIncrementalMode(const std::vector<std::string>& files, const Options& options) {
+    CheckpointStore store(options.stateFile);
+    if (!store.load()) {
+        return 1;
+    }
+
+    LogParser parser;
+    LogStats stats;
+    Statistics statistics;
+    LogLevel levelToShow = options.levelFilter.empty() ? LogLevel::ERROR
+                                                       : LogParser::stringToLogLevel(options.levelFilter);
+    std::vector<LogEntry> shownEntries;
+
+    for (const auto& file : files) {
+        FileCheckpoint checkpoint = store.find(file).value_or(FileCheckpoint{});
+        ResumeResult result = resumeFromCheckpoint(file, checkpoint, parser, [&](const LogEntry& entry) {
+            bool matches = options.keyword.empty() ? entry.level == levelToShow
+                                                   : entry.originalLine.find(options.keyword) != std::string::npos;
+            if (matches) {
+                shownEntries.push_back(entry);
+            }
+        });
+
+        if (!result.rotatedPath.empty()) {
+            std::cout << "로테이션된 이전 파일 " << result.rotatedPath << " 에서 남은 " << result.rotatedLines
+                      << " 라인을 읽었습니다" << std::endl;
+        }
+        if (result.restarted) {
+            std::cout << "로그 로테이션 감지: " << file << " 을(를) 처음부터 다시 읽었습니다" << std::endl;
+        }
+        std::cout << file << ": +" << result.newLines << " 라인 (오프셋 " << result.startOffset
+                  << " → " << checkpoint.offset << ")" << std::endl;
+
+        store.update(checkpoint);
+        checkpoint.addTo(statistics);
+        statistics.fileSize += checkpoint.offset;
+        statistics.filePath += (statistics.filePath.empty() ? "" : ", ") + file;
+    }
+
+    if (!store.save()) {
+        return 1;
+    }
+
+    // 통계는 누적값, 출력 엔트리는 이번에 새로 읽은 부분에서만
+    reportStats(stats, statistics, options);
+    if (!options.keyword.empty()) {
+        stats.printKeywordMatches(shownEntries, options.keyword);
+    } else if (!shownEntries.empty()) {
+        stats.printEntriesByLevel(shownEntries, levelToShow);
+    }
+
+    return 0;
+}
+
+// --tail 조건 (키워드, 레벨, 시간 범위)
+struct TailFilter {
+    const Options& options;
+    LogLevel level;
+    TimeWindowFilter window;
+
+    explicit TailFilter(const Options& tailOptions)
+        : options(tailOptions),
+          level(tailOptions.levelFilter.empty() ? LogLevel::UNKNOWN : LogParser::stringToLogLevel(tailOptions.levelFilter)),
+          window(tailOptions) {}
+
+    // 키워드와 레벨만 (시간 범위는 읽는 방향에 따라 따로 판정)
+    bool matches(const LogEntry& entry) const {
+        return (options.keyword.empty() || entry.originalLine.find(options.keyword) != std::string::npos) &&
+               (level == LogLevel::UNKNOWN || entry.level == level);
+    }
+
+    // 앞에서부터 읽을 때: 모든 라인을 window 에 넘겨 타임스탬프 없는 라인이 앞 라인을 따르게 함
+    bool accept(const LogEntry& entry) {
+        bool inWindow = window.accept(entry);
+        return inWindow && matches(entry);
+    }
+};
+
+// --tail 로 찾은 엔트리 출력
+void printTailEntries(std::deque<LogEntry>& found, const TailFilter& filter) {
+    std::vector<LogEntry> entries(std::make_move_iterator(found.begin()), std::make_move_iterator(found.end()));
+    LogStats stats;
+    if (!filter.options.keyword.empty()) {
+        stats.printKeywordMatches(entries, filter.options.keyword);
+    } else if (filter.level != LogLevel::UNKNOWN) {
+        stats.printEntriesByLevel(entries, filter.level);
+    } else {
+        std::cout << "\n=== 마지막 " << entries.size() << " 라인 ===\n";
+        for (const auto& entry : entries) {
+            std::cout << entry.originalLine << "\n";
+        }
+    }
+}
+
+// 조건에 맞는 마지막 N 개 엔트리만 출력 (파일 끝에서부터 읽다가 N 개를 찾으면 멈춤)
+int runTailMode(const std::string& filePath, const Options& options) {
+    LogFileReader reader(filePath);
+    if (!reader.isValid()) {
+        std::cerr << "파일을 읽을 수 없습니다: " << filePath << std::endl;
+        return 1;
+    }
+
+    LogParser parser;
+    TailFilter filter(options);
+
+    std::deque<LogEntry> found;
+    std::string line;
+    if (!reader.isCompressed() && !reader.isStandardInput()) {
+        // 타임스탬프 없는 라인의 시간 판정은 그보다 앞(뒤에서부터 읽으면 나중)의 타임스탬프 라인이 정하므로 모아 둠
+        std::vector<LogEntry> untimed;
+        auto settleUntimed = [&](bool inWindow) {
+            for (auto& entry : untimed) {
+                if (inWindow && filter.matches(entry)) {
+                    found.push_front(std::move(entry));
+                }
+            }
+            untimed.clear();
+        };
+
+        reader.forEachLineReverse([&](std::string_view view) {
+            line.assign(view.data(), view.size());
+            LogEntry entry = parser.parseLine(line);
+            if (filter.window.isActive() && entry.timestamp.empty()) {
+                untimed.push_back(std::move(entry));
+                return true;
+            }
+
+            bool inWindow = !filter.window.isActive() || filter.window.contains(entry.timestamp);
+            settleUntimed(inWindow);
+            if (inWindow && filter.matches(entry)) {
+                found.push_front(std::move(entry));
+            }
+            // 한꺼번에 붙인 라인이 넘치면 더 이른 쪽을 버림
+            while (found.size() > options.tailCount) {
+                found.pop_front();
+            }
+            return found.size() < options.tailCount;
+        });
+        settleUntimed(filter.window.acceptsLeadingLines());
+        while (found.size() > options.tailCount) {
+            found.pop_front();
+        }
+    } else {
+        // 뒤에서부터 읽을 수 없는 입력은 앞에서부터 읽으며 마지막 N 개만 유지
+        while (auto view = reader.readNextLineView()) {
+            line.assign(view->data(), view->size());
+            LogEntry entry = parser.parseLine(line);
+            if (filter.accept(entry)) {
+                found.push_back(std::move(entry));
+                if (found.size() > options.tailCount) {
+                    found.pop_front();
+                }
+            }
+        }
+    }
+
+    printTailEntries(found, filter);
+    return readExitCode(reader);
+}
+
+// 여러 파일을 타임스탬프 순으로 병합한 흐름에서 조건에 맞는 마지막 N 개 엔트리만 출력
+// 병합 순서의 끝은 파일마다 뒤에서부터 읽어서는 정할 수 없으므로 앞에서부터 병합하며 N 개만 유지
+int runMergedTailMode(const std::vector<std::string>& files, const Options& options) {
+    LogMerger merger(files);
+    if (!merger.isValid()) {
+        std::cerr << "읽을 수 있는 파일이 없습니다" << std::endl;
+        return 1;
+    }
+
+    TailFilter filter(options);
+    std::deque<LogEntry> found;
+    while (auto entry = merger.next()) {
+        if (filter.accept(*entry)) {
+            found.push_back(std::move(*entry));
+            if (found.size() > options.tailCount) {
+                found.pop_front();
+            }
+        }
+    }
+
+    printTailEntries(found, filter);
+    return merger.hasErrors() ? 1 : 0;
+}
+
+// 지정한 라인 범위만 출력 (.lidx 라인 인덱스로 처음부터 다시 읽지 않고 바로 이동)
+int runLineRange(const std::string& filePath, const Options& options) {
+    LogFileReader reader(filePath);
+    if (!reader.isValid() || reader.isCompressed() || reader.isStandardInput()) {
+        std::cerr << "라인 범위는 비압축 파일에서만 읽을 수 있습니다: " << filePath << std::endl;
+        return 1;
+    }
+
+    auto lines = reader.readLineRange(options.lineRangeStart, options.lineRangeCount);
+    std::cout << "=== " << filePath << " 라인 " << options.lineRangeStart << "부터 " << lines.size()
+              << "개 (전체 " << reader.getLineCount() << " 라인) ===\n";
+    for (std::size_t i = 0; i < lines.size(); ++i) {
+        std::cout << "[" << options.lineRangeStart + i << "] " << lines[i] << "\n";
+    }
+
+    return 0;
+}
+
+// 무작위 블록만 읽어 전체 통계를 추정 (레벨 비율마다 95% 신뢰구간을 함께 출력)
+int runSampleMode(const std::string& filePath, const Options& options) {
+    LogFileReader reader(filePath);
+    if (!reader.isValid() || reader.isCompressed()) {
+        std::cerr << "표본 분석은 비압축 파일에서만 할 수 있습니다: " << filePath << std::endl;
+        return 1;
+    }
+
+    std::uintmax_t fileSize = reader.getFileSize();
+    std::size_t blockSize = LogFileReader::SAMPLE_BLOCK_SIZE;
+    std::size_t populationBlocks = static_cast<std::size_t>((fileSize + blockSize - 1) / blockSize);
+    auto chunks = reader.sampleBlocks(options.sampleFraction, std::random_device{}(), blockSize);
+
+    // 단일 파일 분석과 같은 조건을 블록마다 적용 (키워드/시간 범위는 라인으로, 레벨은 파싱 결과로)
+    LogLevel levelFilter = LogLevel::UNKNOWN;
+    if (!options.levelFilter.empty()) {
+        levelFilter = LogParser::stringToLogLevel(options.levelFilter);
+        if (levelFilter == LogLevel::UNKNOWN) {
+            std::cerr << "알 수 없는 로그 레벨: " << options.levelFilter << std::endl;
+        }
+    }
+
+    // 블록마다 독립적으로 세므로 여러 스레드가 다음 블록을 가져가며 처리
+    // 레벨만 필요하므로 LogEntry 대신 ParsedBatch 의 levels 열로 셈
+    LogParser parser;
+    LogStats stats;
+    std::vector<BlockCounts> blocks(chunks.size());
+    ThreadPool& pool = ThreadPool::shared(options.threadCount);
+    pool.run(chunks.size(), [&](std::size_t i) {
+        // 블록 첫 타임스탬프 앞의 라인은 앞 블록을 모르므로 --since 가 없을 때만 범위 안으로 봄
+        TimeWindowFilter window(options);
+        LineBatch lines;
+        reader.forEachLineInChunk(chunks[i], [&](std::string_view line, std::size_t) {
+            // 타임스탬프 없는 라인이 앞 라인을 따르도록 키워드와 관계없이 모든 라인을 window 에 넘김
+            if (window.isActive()) {
+                std::size_t start = LogParser::findTimestamp(line);
+                std::string_view timestamp = start == std::string_view::npos
+                                                 ? std::string_view()
+                                                 : line.substr(start, LogParser::TIMESTAMP_LENGTH);
+                if (!window.accept(timestamp)) {
+                    return;
+                }
+            }
+            if (options.keyword.empty() || line.find(options.keyword) != std::string_view::npos) {
+                lines.append(line);
+            }
+        });
+        ParsedBatch parsed;
+        parser.parseBatch(lines, parsed);
+        auto levelCounts = stats.countLevels(parsed);
+        if (levelFilter != LogLevel::UNKNOWN) {
+            std::size_t matching = levelCounts[levelFilter];
+            blocks[i].lines = matching;
+            blocks[i].levelCounts = {{levelFilter, matching}};
+        } else {
+            blocks[i].lines = parsed.size();
+            blocks[i].levelCounts = std::move(levelCounts);
+        }
+    });
+
+    std::uintmax_t sampledBytes = 0;
+    for (const auto& chunk : chunks) {
+        sampledBytes += chunk.length;
+    }
+
+    auto statistics = stats.calculateSampledStats(blocks, sampledBytes, populationBlocks, filePath, fileSize);
+    reportStats(stats, statistics, options);
+
+    return 0;
+}
+
+// 단일 파일 분석
+int runSingleFile(const std::string& filePath, const Options& options) {
+    // 1. 파일 읽기
+    std::cout << "로그 파일 분석 시작: " << filePath << std::endl;
+
+    LogFileReader reader(filePath, options.readMode);
+    if (!reader.isValid()) {
+        std::cerr << "파일을 읽을 수 없습니다: " << filePath << std::endl;
+        return 1;
+    }
+
+    // 2. 로그 파싱 (라인 바이트는 묶음 버퍼에 한 번만 담고 엔트리는 그 안의 위치만 가짐)
+    LogParser parser;
+    CompactLogBatch allEntries;
+    TimeWindowFilter window(options);
+
+    if (window.isActive() && !reader.isCompressed()) {
+        // 시간순으로 기록된 파일을 이분 탐색해 범위에 해당하는 바이트 구간만 읽음
+        FileChunk range = reader.findTimeRange(options.since, options.until);
+        std::cout << "시간 범위 구간: " << range.offset << " ~ " << range.offset + range.length << " bytes" << std::endl;
+        LineBatch lines;
+        reader.readChunkLines(range, lines);
+        allEntries = parser.parseCompact(std::move(lines));
+    } else if (options.threadCount > 1 && !reader.isCompressed()) {
+        // 구간마다 독립적으로 읽고 파싱한 뒤 파일 순서대로 이어 붙임
+        ThreadPool& pool = ThreadPool::shared(options.threadCount);
+        auto chunks = reader.splitIntoChunks(options.threadCount, pool);
+        if (chunks.empty() && reader.getFileSize() > 0) {
+            return 1;
+        }
+        std::vector<CompactLogBatch> chunkEntries(chunks.size());
+        pool.run(chunks.size(), [&](std::size_t i) {
+            LineBatch lines;
+            reader.readChunkLines(chunks[i], lines);
+            chunkEntries[i] = parser.parseCompact(std::move(lines));
+        });
+
+        for (auto& part : chunkEntries) {
+            allEntries.append(std::move(part));
+        }
+    } else {
+        // 압축/표준 입력은 읽기는 순차로 하되 읽어 둔 묶음의 파싱은 나눠서 함
+        ThreadPool& pool = ThreadPool::shared(options.threadCount);
+        LineBatch lines;
+        while (reader.readLines(lines, COMPACT_BATCH_LINES) > 0) {
+            allEntries.append(parser.parseCompact(std::move(lines), pool));
+        }
+        if (window.isActive()) {
+            // 압축 파일은 탐색할 수 없으므로 전체를 풀면서 거름 (판정이 앞 라인에 의존하므로 순서대로)
+            allEntries = allEntries.filter([&](const CompactLogEntry& entry) {
+                return window.accept(allEntries.timestamp(entry));
+            });
+        }
+    }
+
+    std::cout << "파일 크기: " << reader.getFileSize() << " bytes" << std::endl;
+    std::cout << "읽은 라인 수: " << allEntries.size() << std::endl;
+    auto fastPath = parser.fastPathStats();
+    std::ostringstream hitRate;
+    hitRate << std::fixed << std::setprecision(1) << fastPath.hitRate() * 100.0;
+    std::cout << "정형 라인 (빠른 경로): " << fastPath.hits << " / " << fastPath.lines
+              << " (" << hitRate.str() << "%)" << std::endl;
+
+    // 3. 필터링 (키워드): 전체 묶음은 출력에 다시 쓰므로 걸러낸 엔트리만 새 묶음 하나에 담음
+    CompactLogBatch filtered;
+    bool filtering = false;
+    if (!options.keyword.empty()) {
+        filtered = parser.filterByKeyword(allEntries, options.keyword);
+        filtering = true;
+        std::cout << "키워드 '" << options.keyword << "' 필터링 후: " << filtered.size() << " 라인" << std::endl;
+    }
+
+    // 4. 필터링 (로그 레벨): 이미 걸러낸 묶음이 있으면 그 안에서 제자리로 거름
+    LogLevel level = LogLevel::UNKNOWN;
+    if (!options.levelFilter.empty()) {
+        level = LogParser::stringToLogLevel(options.levelFilter);
+        if (level != LogLevel::UNKNOWN) {
+            if (filtering) {
+                filtered.retain([level](const CompactLogEntry& entry) { return entry.level == level; });
+            } else {
+                filtered = parser.filterByLevel(allEntries, level);
+                filtering = true;
+            }
+            std::cout << "로그 레벨 '" << options.levelFilter << "' 필터링 후: " << filtered.size() << " 라인" << std::endl;
+        } else {
+            std::cerr << "알 수 없는 로그 레벨: " << options.levelFilter << std::endl;
+        }
+    }
+
+    // 5. 통계 계산 및 출력 (필터가 없으면 전체 묶음을 그대로 넘기고 이후 출력도 그쪽을 씀)
+    LogStats stats;
+    auto statistics = stats.calculateStats(filtering ? std::move(filtered) : std::move(allEntries),
+                                           filePath, reader.getFileSize());
+    const CompactLogBatch& readEntries = filtering ? allEntries : statistics.compactEntries;
+    reportStats(stats, statistics, options);
+
+    // 6. 특별한 출력 요청 처리
+    if (!options.keyword.empty()) {
+        stats.printKeywordMatches(readEntries, options.keyword);
+    }
+
+    if (level != LogLevel::UNKNOWN) {
+        stats.printEntriesByLevel(readEntries, level);
+    }
+
+    // ERROR 로그가 있으면 항상 출력
+    bool hasErrors = std::any_of(readEntries.begin(), readEntries.end(), [](const CompactLogEntry& entry) {
+        return entry.level == LogLevel::ERROR;
+    });
+    if (hasErrors && options.keyword.empty() && options.levelFilter.empty()) {
+        stats.printEntriesByLevel(readEntries, LogLevel::ERROR);
+    }
+
+    return readExitCode(reader);
+}
+
+} // namespace
+
 void printUsage(const std::string& programName) {
-    std::cout << "사용법: " << programName << " <로그파일> [옵션]\n";
+    std::cout << "사용법: " << programName << " <로그파일|디렉터리|글롭|->... [옵션]\n";
+    std::cout << "  '-' 는 표준 입력(파이프)을 끝까지 스트리밍하며 분석합니다\n";
+    std::cout << "  여러 파일을 주면 타임스탬프 순으로 병합해 하나의 결과로 분석합니다\n";
     std::cout << "옵션:\n";
     std::cout << "  --keyword <키워드>       특정 키워드를 포함한 로그만 출력\n";
     std::cout << "  --level <레벨>           특정 레벨의 로그만 출력 (ERROR, WARNING, INFO, DEBUG)\n";
     std::cout << "  --json                  결과를 JSON 형태로 콘솔에 출력\n";
     std::cout << "  --output-json <파일경로> 결과를 JSON 파일로 저장\n";
     std::cout << "  --detailed              상세 통계 출력\n";
+    std::cout << "  --mmap                  메모리 매핑 방식으로 파일 읽기\n";
+    std::cout << "  --async-read            io_uring 으로 여러 블록을 미리 읽으며 파싱 (미지원 시 pread 읽기 스레드)\n";
+    std::cout << "  --threads <개수>         파일을 라인 경계 구간으로 나눠 병렬로 읽고 파싱 (압축/표준 입력은 파싱만 병렬)\n";
+    std::cout << "  --since <시각>           이 시각 이후 로그만 분석 (YYYY-MM-DD HH:MM:SS 또는 앞부분)\n";
+    std::cout << "  --until <시각>           이 시각 이전 로그만 분석 (해당 시각은 제외)\n";
+    std::cout << "  --tail <개수>            조건에 맞는 마지막 N 개만 출력 (파일 끝에서부터 읽다가 멈춤, 여러 파일은 병합 순서 기준)\n";
+    std::cout << "  --state <파일>           파일별 처리 위치와 누적 통계를 저장해 다음 실행은 추가된 부분만 분석\n";
+    std::cout << "  --lines <시작>[:<개수>]   지정한 라인만 출력 (<파일>.lidx 라인 인덱스를 만들어 재사용)\n";
+    std::cout << "  --sample <비율>          파일의 일부 블록(0~1 비율)만 무작위로 읽어 통계를 추정하고 신뢰구간 표시\n";
+    std::cout << "  --follow                파일에 추가되는 라인을 계속 따라가며 통계 갱신 (tail -f)\n";
     std::cout << "  --help                  도움말 출력\n";
 }
 
@@ -26,107 +714,125 @@ int main(int argc, char* argv[]) {
             printUsage(argv[0]);
             return 1;
         }
-        
-        std::string filePath = argv[1];
-        std::string keyword;
-        std::string levelFilter;
-        std::string jsonOutputFile;
-        bool jsonOutput = false;
-        bool detailedOutput = false;
-        
-        // 옵션 파싱
-        for (int i = 2; i < argc; ++i) {
+
+        Options options;
+
+        // 옵션 파싱 (옵션이 아닌 인자는 모두 입력 경로)
+        for (int i = 1; i < argc; ++i) {
             std::string arg = argv[i];
-            
+
             if (arg == "--help") {
                 printUsage(argv[0]);
                 return 0;
             } else if (arg == "--keyword" && i + 1 < argc) {
-                keyword = argv[++i];
+                options.keyword = argv[++i];
             } else if (arg == "--level" && i + 1 < argc) {
-                levelFilter = argv[++i];
+                options.levelFilter = argv[++i];
             } else if (arg == "--json") {
-                jsonOutput = true;
+                options.jsonOutput = true;
             } else if (arg == "--output-json" && i + 1 < argc) {
-                jsonOutputFile = argv[++i];
+                options.jsonOutputFile = argv[++i];
             } else if (arg == "--detailed") {
-                detailedOutput = true;
+                options.detailedOutput = true;
+            } else if (arg == "--mmap") {
+                options.readMode = ReadMode::MemoryMapped;
+            } else if (arg == "--async-read") {
+                options.readMode = ReadMode::AsyncRead;
+            } else if (arg == "--threads" && i + 1 < argc) {
+                options.threadCount = std::max(1, std::stoi(argv[++i]));
+            } else if (arg == "--since" && i + 1 < argc) {
+                options.since = argv[++i];
+            } else if (arg == "--until" && i + 1 < argc) {
+                options.until = argv[++i];
+            } else if (arg == "--tail" && i + 1 < argc) {
+                auto count = parseCount(argv[++i]);
+                if (!count) {
+                    std::cerr << "잘못된 --tail 개수: " << argv[i] << std::endl;
+                    return 1;
+                }
+                options.tailCount = *count;
+            } else if (arg == "--state" && i + 1 < argc) {
+                options.stateFile = argv[++i];
+            } else if (arg == "--lines" && i + 1 < argc) {
+                // <시작>[:<개수>]
+                std::string range = argv[++i];
+                std::size_t colon = range.find(':');
+                auto start = parseCount(std::string_view(range).substr(0, colon));
+                auto count = colon == std::string::npos ? std::optional<std::size_t>(1)
+                                                        : parseCount(std::string_view(range).substr(colon + 1));
+                if (!start || !count) {
+                    std::cerr << "잘못된 --lines 범위: " << range << std::endl;
+                    return 1;
+                }
+                options.lineRangeStart = *start;
+                options.lineRangeCount = *count;
+            } else if (arg == "--sample" && i + 1 < argc) {
+                options.sampleFraction = std::stod(argv[++i]);
+            } else if (arg == "--follow") {
+                options.followMode = true;
+            } else if (arg.rfind("--", 0) != 0) {
+                options.inputs.push_back(arg);
             }
         }
-        
-        // 1. 파일 읽기
-        std::cout << "로그 파일 분석 시작: " << filePath << std::endl;
-        
-        LogFileReader reader(filePath);
-        if (!reader.isValid()) {
-            std::cerr << "파일을 읽을 수 없습니다: " << filePath << std::endl;
+
+        if (options.inputs.empty()) {
+            printUsage(argv[0]);
             return 1;
         }
-        
-        auto lines = reader.readAllLines();
-        std::cout << "파일 크기: " << reader.getFileSize() << " bytes" << std::endl;
-        std::cout << "읽은 라인 수: " << lines.size() << std::endl;
-        
-        // 2. 로그 파싱
-        LogParser parser;
-        auto entries = parser.parseLines(lines);
-        
-        // 3. 필터링 (키워드)
-        if (!keyword.empty()) {
-            entries = parser.filterByKeyword(entries, keyword);
-            std::cout << "키워드 '" << keyword << "' 필터링 후: " << entries.size() << " 라인" << std::endl;
-        }
-        
-        // 4. 필터링 (로그 레벨)
-        if (!levelFilter.empty()) {
-            LogLevel level = LogParser::stringToLogLevel(levelFilter);
-            if (level != LogLevel::UNKNOWN) {
-                entries = parser.filterByLevel(entries, level);
-                std::cout << "로그 레벨 '" << levelFilter << "' 필터링 후: " << entries.size() << " 라인" << std::endl;
-            } else {
-                std::cerr << "알 수 없는 로그 레벨: " << levelFilter << std::endl;
-            }
-        }
-        
-        // 5. 통계 계산 및 출력
-        LogStats stats;
-        auto statistics = stats.calculateStats(entries, filePath, reader.getFileSize());
-        
-        if (!jsonOutputFile.empty()) {
-            std::ofstream outFile(jsonOutputFile);
-            if (outFile) {
-                outFile << stats.statsToJson(statistics);
-                std::cout << "\n분석 결과를 " << jsonOutputFile << " 파일에 저장했습니다." << std::endl;
-            } else {
-                std::cerr << "JSON 파일을 열 수 없습니다: " << jsonOutputFile << std::endl;
+
+        auto files = LogMerger::expandInputs(options.inputs);
+        if (files.empty()) {
+            std::cerr << "분석할 파일이 없습니다" << std::endl;
+            return 1;
+        }
+
+        if (files.size() == 1 && files.front() == LogFileReader::STDIN_PATH) {
+            if (options.followMode) {
+                std::cerr << "표준 입력은 --follow 없이도 끝까지 스트리밍됩니다" << std::endl;
             }
-        } else if (jsonOutput) {
-            std::cout << stats.statsToJson(statistics) << std::endl;
-        } else if (detailedOutput) {
-            stats.printDetailedStats(statistics);
-        } else {
-            stats.printStats(statistics);
+            if (options.tailCount > 0) {
+                return runTailMode(files.front(), options);
+            }
+            return runStdinMode(options);
+        }
+
+        if (options.lineRangeStart > 0) {
+            return runLineRange(files.front(), options);
+        }
+
+        if (options.tailCount > 0) {
+            return files.size() == 1 ? runTailMode(files.front(), options) : runMergedTailMode(files, options);
         }
-        
-        // 6. 특별한 출력 요청 처리
-        if (!keyword.empty()) {
-            stats.printKeywordMatches(parser.parseLines(reader.readAllLines()), keyword);
+
+        if (!options.stateFile.empty()) {
+            return runIncrementalMode(files, options);
+        }
+
+        if (options.followMode) {
+            if (files.size() > 1) {
+                std::cerr << "--follow 는 파일 하나만 지원합니다 (입력 " << files.size() << "개)" << std::endl;
+                return 1;
+            }
+            return runFollowMode(files.front(), options);
         }
-        
-        if (!levelFilter.empty()) {
-            LogLevel level = LogParser::stringToLogLevel(levelFilter);
-            if (level != LogLevel::UNKNOWN) {
-                stats.printEntriesByLevel(parser.parseLines(reader.readAllLines()), level);
+
+        if (options.sampleFraction > 0.0) {
+            if (files.size() > 1) {
+                std::cerr << "--sample 은 파일 하나만 지원합니다 (입력 " << files.size() << "개)" << std::endl;
+                return 1;
+            }
+            if (options.sampleFraction >= 1.0) {
+                return runSingleFile(files.front(), options);
             }
+            return runSampleMode(files.front(), options);
         }
-        
-        // ERROR 로그가 있으면 항상 출력
-        auto allEntries = parser.parseLines(reader.readAllLines());
-        auto errorEntries = parser.filterByLevel(allEntries, LogLevel::ERROR);
-        if (!errorEntries.empty() && keyword.empty() && levelFilter.empty()) {
-            stats.printEntriesByLevel(allEntries, LogLevel::ERROR);
+
+        if (files.size() > 1) {
+            return runMergeMode(files, options);
         }
-        
+
+        return runSingleFile(files.front(), options);
+
     } catch (const std::exception& e) {
         std::cerr << "오류 발생: " << e.what() << std::endl;
         return 1;
@@ -134,6 +840,4 @@ int main(int argc, char* argv[]) {
         std::cerr << "알 수 없는 오류가 발생했습니다." << std::endl;
         return 1;
     }
-    
-    return 0;
-} 
\ No newline at end of file
+}
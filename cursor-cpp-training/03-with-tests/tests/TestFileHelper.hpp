@@ -0,0 +1,39 @@
+#pragma once
+
+#include <fstream>
+#include <filesystem>
+#include <string>
+
+// 테스트용 임시 파일 생성 헬퍼 함수 (내용은 바이너리 그대로 씀)
+class TestFileHelper {
+public:
+    // 임시 디렉터리 안의 name 경로
+    static std::string tempPath(const std::string& name) {
+        return std::filesystem::temp_directory_path() / name;
+    }
+
+    // 임시 디렉터리에 name 으로 content 를 쓰고 경로를 반환
+    static std::string createTempFile(const std::string& content, const std::string& name = "test_log.txt") {
+        std::string path = tempPath(name);
+        writeFile(path, content);
+        return path;
+    }
+
+    // path 의 기존 내용을 content 로 바꿈
+    static void writeFile(const std::string& path, const std::string& content) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    // path 끝에 content 를 덧붙임
+    static void appendFile(const std::string& path, const std::string& content) {
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        file << content;
+    }
+
+    static void deleteTempFile(const std::string& path) {
+        if (std::filesystem::exists(path)) {
+            std::filesystem::remove(path);
+        }
+    }
+};
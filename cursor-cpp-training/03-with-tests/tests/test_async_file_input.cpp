@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../AsyncFileInput.hpp"
+#include "../LogFileReader.hpp"
+#include "TestFileHelper.hpp"
+#include <fstream>
+#include <filesystem>
+#include <istream>
+#include <iterator>
+#include <sys/stat.h>
+
+using namespace LogAnalyzer;
+
+namespace {
+
+std::string readThrough(std::streambuf* buffer) {
+    std::istream input(buffer);
+    return std::string(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+TEST_CASE("비동기 미리 읽기 streambuf", "[AsyncFileInput]") {
+    // 블록 크기의 배수, 배수가 아닌 크기, 블록보다 작은 크기, 빈 파일
+    std::string content;
+    for (int i = 0; i < 1000; ++i) {
+        content += "2023-12-01 10:30:15 INFO line " + std::to_string(i) + "\n";
+    }
+
+    for (AsyncReadBackend backend : {AsyncReadBackend::IoUring, AsyncReadBackend::PreadThread}) {
+        for (std::size_t size : {std::size_t(0), std::size_t(100), std::size_t(4096), content.size()}) {
+            std::string path = TestFileHelper::createTempFile(content.substr(0, size), "test_async_read.log");
+
+            auto buffer = createAsyncReadStreamBuf(path, backend, 1024, 3);
+            REQUIRE(buffer != nullptr);
+            REQUIRE(readThrough(buffer.get()) == content.substr(0, size));
+
+            std::filesystem::remove(path);
+        }
+    }
+
+    SECTION("없는 파일") {
+        std::string path = std::filesystem::temp_directory_path() / "test_async_missing.log";
+        REQUIRE(createAsyncReadStreamBuf(path, AsyncReadBackend::PreadThread) == nullptr);
+    }
+
+    SECTION("정상적으로 끝까지 읽으면 읽기 오류 없음") {
+        std::string path = TestFileHelper::createTempFile(content, "test_async_read.log");
+        for (AsyncReadBackend backend : {AsyncReadBackend::IoUring, AsyncReadBackend::PreadThread}) {
+            auto buffer = createAsyncReadStreamBuf(path, backend, 1024, 3);
+            REQUIRE(readThrough(buffer.get()) == content);
+            REQUIRE_FALSE(buffer->hasReadError());
+        }
+        std::filesystem::remove(path);
+    }
+
+    SECTION("읽기가 실패하면 EOF 가 아니라 읽기 오류") {
+        // 디렉터리는 열리고 크기도 있지만 read 가 EISDIR 로 실패함
+        std::string path = std::filesystem::temp_directory_path() / "test_async_dir";
+        std::filesystem::create_directories(path);
+        struct stat info {};
+        REQUIRE(::stat(path.c_str(), &info) == 0);
+        for (AsyncReadBackend backend : {AsyncReadBackend::IoUring, AsyncReadBackend::PreadThread}) {
+            auto buffer = createAsyncReadStreamBuf(path, backend, 1024, 3);
+            REQUIRE(buffer != nullptr);
+            REQUIRE(readThrough(buffer.get()).empty());
+            REQUIRE(buffer->hasReadError() == (info.st_size > 0));
+        }
+        std::filesystem::remove(path);
+    }
+
+    SECTION("끝까지 읽지 않고 소멸") {
+        std::string path = TestFileHelper::createTempFile(content, "test_async_read.log");
+        for (AsyncReadBackend backend : {AsyncReadBackend::IoUring, AsyncReadBackend::PreadThread}) {
+            auto buffer = createAsyncReadStreamBuf(path, backend, 512, 4);
+            REQUIRE(buffer != nullptr);
+            REQUIRE(buffer->sgetc() == '2');
+        }
+        std::filesystem::remove(path);
+    }
+}
+
+TEST_CASE("LogFileReader 비동기 읽기 모드", "[AsyncFileInput]") {
+    std::string path = TestFileHelper::createTempFile("Line 1\nLine 2\r\n\nLine 4", "test_async_reader.log");
+
+    LogFileReader reader(path, ReadMode::AsyncRead);
+    REQUIRE(reader.isValid());
+    REQUIRE(reader.getReadMode() == ReadMode::AsyncRead);
+
+    REQUIRE(reader.readNextLine() == std::optional<std::string>("Line 1"));
+    REQUIRE(reader.readAllLines() == std::vector<std::string>{"Line 1", "Line 2", "", "Line 4"});
+    REQUIRE_FALSE(reader.readNextLine().has_value());
+
+    std::filesystem::remove(path);
+}
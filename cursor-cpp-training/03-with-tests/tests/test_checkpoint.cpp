@@ -0,0 +1,188 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../Checkpoint.hpp"
+#include "TestFileHelper.hpp"
+#include <fstream>
+#include <filesystem>
+
+using namespace LogAnalyzer;
+
+namespace {
+
+std::string checkpointLogPath() {
+    return std::filesystem::temp_directory_path() / "test_checkpoint.log";
+}
+
+std::string checkpointStatePath() {
+    return std::filesystem::temp_directory_path() / "test_checkpoint.state";
+}
+
+// 체크포인트 이후 부분을 처리하고 넘겨받은 라인 목록을 반환
+std::vector<std::string> resume(FileCheckpoint& checkpoint, ResumeResult* result = nullptr) {
+    LogParser parser;
+    std::vector<std::string> lines;
+    ResumeResult r = resumeFromCheckpoint(checkpointLogPath(), checkpoint, parser, [&lines](const LogEntry& entry) {
+        lines.push_back(entry.originalLine);
+    });
+    if (result != nullptr) {
+        *result = r;
+    }
+    return lines;
+}
+
+} // namespace
+
+TEST_CASE("체크포인트 이후 추가분만 처리", "[Checkpoint]") {
+    std::string path = checkpointLogPath();
+    TestFileHelper::writeFile(path, "2023-12-01 10:00:00 ERROR a\n2023-12-01 10:00:01 INFO b\n");
+
+    FileCheckpoint checkpoint;
+    ResumeResult result;
+    REQUIRE(resume(checkpoint, &result).size() == 2);
+    REQUIRE_FALSE(result.restarted);
+    REQUIRE(checkpoint.offset == std::filesystem::file_size(path));
+    REQUIRE(checkpoint.totalLines == 2);
+
+    SECTION("변경이 없으면 아무것도 읽지 않음") {
+        REQUIRE(resume(checkpoint).empty());
+        REQUIRE(checkpoint.totalLines == 2);
+    }
+
+    SECTION("추가된 라인만 읽고 카운터에 누적") {
+        TestFileHelper::appendFile(path, "2023-12-01 10:00:02 ERROR c\n");
+        REQUIRE(resume(checkpoint) == std::vector<std::string>{"2023-12-01 10:00:02 ERROR c"});
+        REQUIRE(checkpoint.totalLines == 3);
+        REQUIRE(checkpoint.levelCounts[LogLevel::ERROR] == 2);
+        REQUIRE(checkpoint.levelCounts[LogLevel::INFO] == 1);
+    }
+
+    SECTION("쓰는 중인 라인은 다음 실행으로") {
+        TestFileHelper::appendFile(path, "2023-12-01 10:00:02 WARN par");
+        REQUIRE(resume(checkpoint).empty());
+
+        TestFileHelper::appendFile(path, "tial\n");
+        REQUIRE(resume(checkpoint) == std::vector<std::string>{"2023-12-01 10:00:02 WARN partial"});
+    }
+
+    SECTION("로테이션되면 새 파일을 처음부터 읽고 누적 유지") {
+        // 기존 파일이 살아 있는 동안 새 파일을 만들어야 inode 가 재사용되지 않음
+        TestFileHelper::writeFile(path + ".new", "2023-12-01 11:00:00 INFO new\n");
+        std::filesystem::rename(path + ".new", path);
+        REQUIRE(resume(checkpoint, &result) == std::vector<std::string>{"2023-12-01 11:00:00 INFO new"});
+        REQUIRE(result.restarted);
+        REQUIRE(result.rotatedMissing);
+        REQUIRE(checkpoint.totalLines == 3);
+    }
+
+    SECTION("rename 로테이션: 이전 파일(.1)의 남은 라인을 먼저 읽음") {
+        TestFileHelper::appendFile(path, "2023-12-01 10:00:02 WARN c\n");
+        std::filesystem::rename(path, path + ".1");
+        TestFileHelper::writeFile(path, "2023-12-01 11:00:00 INFO new\n");
+
+        REQUIRE(resume(checkpoint, &result) == std::vector<std::string>{
+            "2023-12-01 10:00:02 WARN c", "2023-12-01 11:00:00 INFO new"});
+        REQUIRE(result.restarted);
+        REQUIRE(result.rotatedPath == path + ".1");
+        REQUIRE(result.rotatedLines == 1);
+        REQUIRE_FALSE(result.rotatedMissing);
+        REQUIRE(checkpoint.totalLines == 4);
+    }
+
+    SECTION("copytruncate: 사본에서 남은 라인을 먼저 읽음") {
+        TestFileHelper::appendFile(path, "2023-12-01 10:00:02 WARN c\n");
+        std::filesystem::copy_file(path, path + ".1");
+        TestFileHelper::writeFile(path, "2023-12-01 11:00:00 INFO new\n");
+
+        REQUIRE(resume(checkpoint, &result) == std::vector<std::string>{
+            "2023-12-01 10:00:02 WARN c", "2023-12-01 11:00:00 INFO new"});
+        REQUIRE(result.restarted);
+        REQUIRE(result.rotatedPath == path + ".1");
+    }
+
+    SECTION("잘리면 처음부터") {
+        TestFileHelper::writeFile(path, "x\n");
+        REQUIRE(resume(checkpoint, &result) == std::vector<std::string>{"x"});
+        REQUIRE(result.restarted);
+        REQUIRE(result.startOffset == 0);
+    }
+
+    SECTION("잘린 뒤 오프셋보다 커졌어도 내용이 다르면 처음부터") {
+        std::string rewritten = "2023-12-01 12:00:00 INFO rewritten line that is longer than before\n";
+        TestFileHelper::writeFile(path, rewritten);
+        REQUIRE(std::filesystem::file_size(path) > checkpoint.offset);
+
+        REQUIRE(resume(checkpoint, &result) == std::vector<std::string>{rewritten.substr(0, rewritten.size() - 1)});
+        REQUIRE(result.restarted);
+        REQUIRE(result.startOffset == 0);
+    }
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(path + ".1");
+}
+
+TEST_CASE("체크포인트 상태 파일 저장과 읽기", "[Checkpoint]") {
+    std::string statePath = checkpointStatePath();
+    std::filesystem::remove(statePath);
+
+    SECTION("없으면 빈 상태") {
+        CheckpointStore store(statePath);
+        REQUIRE(store.load());
+        REQUIRE(store.getCheckpoints().empty());
+        REQUIRE_FALSE(store.find("/var/log/app.log").has_value());
+    }
+
+    SECTION("저장한 체크포인트를 그대로 읽음") {
+        FileCheckpoint checkpoint;
+        checkpoint.filePath = "/var/log/my app.log";
+        checkpoint.device = 2049;
+        checkpoint.inode = 123456;
+        checkpoint.offset = 4096;
+        checkpoint.fingerprint = 0xFEEDFACECAFEBEEFULL;
+        checkpoint.totalLines = 50;
+        checkpoint.levelCounts[LogLevel::ERROR] = 5;
+        checkpoint.levelCounts[LogLevel::INFO] = 45;
+
+        CheckpointStore store(statePath);
+        store.update(checkpoint);
+        checkpoint.offset = 8192;
+        store.update(checkpoint); // 같은 경로는 덮어씀
+        REQUIRE(store.save());
+
+        CheckpointStore loaded(statePath);
+        REQUIRE(loaded.load());
+        REQUIRE(loaded.getCheckpoints().size() == 1);
+        auto found = loaded.find("/var/log/my app.log");
+        REQUIRE(found.has_value());
+        REQUIRE(found->inode == 123456);
+        REQUIRE(found->offset == 8192);
+        REQUIRE(found->fingerprint == 0xFEEDFACECAFEBEEFULL);
+        REQUIRE(found->totalLines == 50);
+        REQUIRE(found->levelCounts[LogLevel::ERROR] == 5);
+        REQUIRE(found->levelCounts[LogLevel::INFO] == 45);
+
+        Statistics stats;
+        found->addTo(stats);
+        found->addTo(stats);
+        REQUIRE(stats.totalLines == 100);
+        REQUIRE(stats.levelCounts[LogLevel::ERROR] == 10);
+    }
+
+    SECTION("지문이 없는 이전 형식(v1)도 읽음") {
+        TestFileHelper::writeFile(statePath, "# log_analyzer checkpoint v1\n2049 7 100 3 0 1 0 2 0 /var/log/app.log\n");
+        CheckpointStore store(statePath);
+        REQUIRE(store.load());
+        auto found = store.find("/var/log/app.log");
+        REQUIRE(found.has_value());
+        REQUIRE(found->offset == 100);
+        REQUIRE(found->fingerprint == 0);
+        REQUIRE(found->totalLines == 3);
+        REQUIRE(found->levelCounts[LogLevel::INFO] == 2);
+    }
+
+    SECTION("형식이 다르면 거부") {
+        TestFileHelper::writeFile(statePath, "not a checkpoint\n");
+        CheckpointStore store(statePath);
+        REQUIRE_FALSE(store.load());
+    }
+
+    std::filesystem::remove(statePath);
+}
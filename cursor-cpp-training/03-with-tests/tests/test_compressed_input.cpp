@@ -0,0 +1,210 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../CompressedInput.hpp"
+#include "TestFileHelper.hpp"
+#include <fstream>
+#include <filesystem>
+#include <istream>
+#include <iterator>
+#include <stdexcept>
+
+using namespace LogAnalyzer;
+
+TEST_CASE("압축 형식 판별 테스트", "[CompressedInput]") {
+    SECTION("gzip 매직 바이트") {
+        std::string path = TestFileHelper::createTempFile(std::string("\x1f\x8b\x08\x00", 4), "test_magic.bin");
+        REQUIRE(detectCompression(path) == Compression::Gzip);
+        std::filesystem::remove(path);
+    }
+    
+    SECTION("zstd 매직 바이트") {
+        std::string path = TestFileHelper::createTempFile(std::string("\x28\xb5\x2f\xfd", 4), "test_magic.bin");
+        REQUIRE(detectCompression(path) == Compression::Zstd);
+        std::filesystem::remove(path);
+    }
+    
+    SECTION("일반 텍스트와 짧은 파일") {
+        std::string path = TestFileHelper::createTempFile("2023-12-01 10:30:15 INFO x\n", "test_magic.bin");
+        REQUIRE(detectCompression(path) == Compression::None);
+        std::filesystem::remove(path);
+        
+        path = TestFileHelper::createTempFile("\x1f", "test_magic.bin");
+        REQUIRE(detectCompression(path) == Compression::None);
+        std::filesystem::remove(path);
+    }
+}
+
+TEST_CASE("BlockQueue 생산자/소비자 테스트", "[CompressedInput]") {
+    SECTION("넣은 순서대로 꺼내고 종료 후 nullopt") {
+        BlockQueue queue(2);
+        REQUIRE(queue.push("a"));
+        REQUIRE(queue.push("b"));
+        queue.finish();
+        
+        REQUIRE(queue.pop() == std::optional<std::string>("a"));
+        REQUIRE(queue.pop() == std::optional<std::string>("b"));
+        REQUIRE_FALSE(queue.pop().has_value());
+    }
+    
+    SECTION("취소하면 생산자 push 가 실패") {
+        BlockQueue queue(1);
+        queue.cancel();
+        REQUIRE(queue.isCancelled());
+        REQUIRE_FALSE(queue.push("a"));
+    }
+    
+    SECTION("실패로 끝내도 넣은 항목은 꺼내고 EOF 와 구분됨") {
+        BlockQueue queue(2);
+        REQUIRE(queue.push("a"));
+        queue.fail();
+        
+        REQUIRE(queue.pop() == std::optional<std::string>("a"));
+        REQUIRE_FALSE(queue.pop().has_value());
+        REQUIRE(queue.hasFailed());
+    }
+}
+
+TEST_CASE("DecodingStreamBuf 블록 경계를 넘는 라인 읽기", "[CompressedInput]") {
+    DecodingStreamBuf buffer([](BlockQueue& queue) {
+        queue.push("first li");
+        queue.push("");
+        queue.push("ne\nsecond line\nthi");
+        queue.push("rd");
+    }, 1);
+    std::istream input(&buffer);
+    
+    std::string line;
+    REQUIRE(std::getline(input, line));
+    REQUIRE(line == "first line");
+    REQUIRE(std::getline(input, line));
+    REQUIRE(line == "second line");
+    REQUIRE(std::getline(input, line));
+    REQUIRE(line == "third");
+    REQUIRE_FALSE(std::getline(input, line));
+    REQUIRE_FALSE(buffer.hasReadError());
+}
+
+TEST_CASE("DecodingStreamBuf 생산자 실패는 읽기 오류로 보고", "[CompressedInput]") {
+    SECTION("fail 호출") {
+        DecodingStreamBuf buffer([](BlockQueue& queue) {
+            queue.push("partial line\n");
+            queue.fail();
+        }, 1);
+        std::istream input(&buffer);
+        
+        std::string line;
+        REQUIRE(std::getline(input, line));
+        REQUIRE(line == "partial line");
+        REQUIRE_FALSE(std::getline(input, line));
+        REQUIRE(buffer.hasReadError());
+    }
+    
+    SECTION("예외") {
+        DecodingStreamBuf buffer([](BlockQueue&) {
+            throw std::runtime_error("decode");
+        }, 1);
+        std::istream input(&buffer);
+        
+        std::string line;
+        REQUIRE_FALSE(std::getline(input, line));
+        REQUIRE(buffer.hasReadError());
+    }
+}
+
+TEST_CASE("DecodingStreamBuf 중간에 소멸해도 생산자가 멈춤", "[CompressedInput]") {
+    {
+        DecodingStreamBuf buffer([](BlockQueue& queue) {
+            while (queue.push(std::string(1024, 'x'))) {
+            }
+        }, 2);
+        std::istream input(&buffer);
+        char c = 0;
+        REQUIRE(input.get(c));
+        REQUIRE(c == 'x');
+    }
+    REQUIRE(true);
+}
+
+#ifdef LOG_ANALYZER_HAS_ZSTD
+#include <zstd.h>
+
+namespace {
+
+// 각 문자열을 독립된 zstd 프레임으로 압축해 이어 붙임
+std::string createZstdFile(const std::vector<std::string>& frames) {
+    std::string compressed;
+    for (const auto& content : frames) {
+        std::string frame(ZSTD_compressBound(content.size()), '\0');
+        std::size_t size = ZSTD_compress(frame.data(), frame.size(), content.data(), content.size(), 1);
+        REQUIRE_FALSE(ZSTD_isError(size));
+        compressed.append(frame.data(), size);
+    }
+    return TestFileHelper::createTempFile(compressed, "test_log.txt.zst");
+}
+
+std::vector<std::string> readAllLines(std::streambuf* buffer) {
+    std::istream input(buffer);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(input, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+} // namespace
+
+TEST_CASE("zstd 다중 프레임 병렬 해제 테스트", "[CompressedInput]") {
+    // 라인이 프레임 경계에 걸치도록 나눔
+    std::vector<std::string> frames;
+    std::vector<std::string> expected;
+    std::string pending;
+    for (int i = 1; i <= 2000; ++i) {
+        std::string line = "2023-12-01 10:30:15 INFO zstd line " + std::to_string(i);
+        expected.push_back(line);
+        pending += line + "\n";
+        if (i % 97 == 0) {
+            std::size_t cut = pending.size() - 5;
+            frames.push_back(pending.substr(0, cut));
+            pending = pending.substr(cut);
+        }
+    }
+    frames.push_back(pending);
+    std::string path = createZstdFile(frames);
+    
+    REQUIRE(detectCompression(path) == Compression::Zstd);
+    
+    SECTION("여러 스레드로 풀어도 파일 순서 유지") {
+        auto buffer = createZstdStreamBuf(path, 4);
+        REQUIRE(buffer != nullptr);
+        REQUIRE(readAllLines(buffer.get()) == expected);
+    }
+    
+    SECTION("단일 스레드 스트리밍과 동일") {
+        auto buffer = createZstdStreamBuf(path, 1);
+        REQUIRE(readAllLines(buffer.get()) == expected);
+        REQUIRE_FALSE(buffer->hasReadError());
+    }
+    
+    SECTION("잘리거나 손상된 파일은 EOF 가 아니라 읽기 오류") {
+        std::ifstream original(path, std::ios::binary);
+        std::string compressed((std::istreambuf_iterator<char>(original)), std::istreambuf_iterator<char>());
+        
+        std::string corrupted = compressed;
+        for (std::size_t i = compressed.size() / 2; i < compressed.size() / 2 + 64; ++i) {
+            corrupted[i] = static_cast<char>(~corrupted[i]);
+        }
+        
+        for (const std::string& broken : {compressed.substr(0, compressed.size() / 2), corrupted}) {
+            std::string brokenPath = TestFileHelper::createTempFile(broken, "test_log_broken.txt.zst");
+            for (std::size_t threadCount : {1, 4}) {
+                auto buffer = createZstdStreamBuf(brokenPath, threadCount);
+                REQUIRE(readAllLines(buffer.get()).size() < expected.size());
+                REQUIRE(buffer->hasReadError());
+            }
+            std::filesystem::remove(brokenPath);
+        }
+    }
+    
+    std::filesystem::remove(path);
+}
+#endif
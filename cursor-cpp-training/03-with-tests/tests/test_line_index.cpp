@@ -0,0 +1,203 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../LineIndex.hpp"
+#include "../LogFileReader.hpp"
+#include <fstream>
+#include <filesystem>
+
+using namespace LogAnalyzer;
+
+namespace {
+
+std::string indexTestPath() {
+    return std::filesystem::temp_directory_path() / "test_line_index.log";
+}
+
+std::string writeLines(std::size_t count, bool terminated = true) {
+    std::string path = indexTestPath();
+    std::ofstream file(path, std::ios::trunc);
+    for (std::size_t i = 1; i <= count; ++i) {
+        file << "line " << i;
+        if (i < count || terminated) {
+            file << "\n";
+        }
+    }
+    return path;
+}
+
+void removeWithSidecar(const std::string& path) {
+    std::filesystem::remove(path);
+    std::filesystem::remove(LineIndex::sidecarPath(path));
+}
+
+} // namespace
+
+TEST_CASE("LineIndex 표본 오프셋 생성", "[LineIndex]") {
+    SECTION("표본 간격마다 라인 시작 오프셋") {
+        // "line 1\n" ~ "line 9\n" 은 7바이트, "line 10\n" 부터 8바이트
+        std::string path = writeLines(10);
+        auto index = LineIndex::build(path, 3);
+        REQUIRE(index.has_value());
+        REQUIRE(index->getLineCount() == 10);
+        REQUIRE(index->getSampleOffsets() == std::vector<std::uintmax_t>{0, 21, 42, 63});
+
+        REQUIRE(index->nearestSample(1) == std::make_pair(std::size_t(1), std::uintmax_t(0)));
+        REQUIRE(index->nearestSample(6) == std::make_pair(std::size_t(4), std::uintmax_t(21)));
+        REQUIRE(index->nearestSample(10) == std::make_pair(std::size_t(10), std::uintmax_t(63)));
+        removeWithSidecar(path);
+    }
+
+    SECTION("개행 없이 끝나는 마지막 라인과 빈 파일") {
+        std::string path = writeLines(4, false);
+        auto index = LineIndex::build(path, 2);
+        REQUIRE(index->getLineCount() == 4);
+        REQUIRE(index->getSampleOffsets().size() == 2);
+
+        path = writeLines(0);
+        index = LineIndex::build(path, 2);
+        REQUIRE(index->getLineCount() == 0);
+        REQUIRE(index->getSampleOffsets().empty());
+        removeWithSidecar(path);
+    }
+
+    SECTION("없는 파일") {
+        REQUIRE_FALSE(LineIndex::build("/non/existent/file.log").has_value());
+    }
+}
+
+TEST_CASE("LineIndex sidecar 저장과 검증", "[LineIndex]") {
+    std::string path = writeLines(100);
+
+    SECTION("저장한 인덱스를 그대로 읽음") {
+        auto built = LineIndex::build(path, 7);
+        REQUIRE(built->save());
+        REQUIRE(std::filesystem::exists(LineIndex::sidecarPath(path)));
+
+        auto loaded = LineIndex::load(path);
+        REQUIRE(loaded.has_value());
+        REQUIRE(loaded->getLineCount() == 100);
+        REQUIRE(loaded->getSampleInterval() == 7);
+        REQUIRE(loaded->getSampleOffsets() == built->getSampleOffsets());
+    }
+
+    SECTION("반복 저장해도 임시 파일이 남지 않음") {
+        auto built = LineIndex::build(path, 7);
+        REQUIRE(built->save());
+        REQUIRE(built->save());
+        std::string prefix = std::filesystem::path(LineIndex::sidecarPath(path)).filename().string() + ".";
+        for (const auto& item : std::filesystem::directory_iterator(std::filesystem::path(path).parent_path())) {
+            REQUIRE(item.path().filename().string().rfind(prefix, 0) != 0);
+        }
+    }
+
+    SECTION("파일이 바뀌면 무효") {
+        REQUIRE(LineIndex::build(path, 7)->save());
+        std::ofstream(path, std::ios::app) << "line 101\n";
+        REQUIRE_FALSE(LineIndex::load(path).has_value());
+
+        // loadOrBuild 는 갱신된 인덱스를 저장
+        auto rebuilt = LineIndex::loadOrBuild(path, 7);
+        REQUIRE(rebuilt->getLineCount() == 101);
+        REQUIRE(LineIndex::load(path)->getLineCount() == 101);
+    }
+
+    SECTION("뒤에 추가만 되었으면 마지막 표본부터 이어서 인덱싱") {
+        REQUIRE(LineIndex::build(path, 7)->save());
+        std::ofstream(path, std::ios::app) << "line 101\nline 102\n";
+
+        // 다시 만들었다면 요청한 간격(5)이 되므로 간격으로 이어 붙였는지 확인
+        auto extended = LineIndex::loadOrBuild(path, 5);
+        REQUIRE(extended->getSampleInterval() == 7);
+        REQUIRE(extended->getLineCount() == 102);
+        REQUIRE(extended->getSampleOffsets() == LineIndex::build(path, 7)->getSampleOffsets());
+        REQUIRE(LineIndex::load(path)->getLineCount() == 102);
+    }
+
+    SECTION("기존 범위의 내용이 바뀌었으면 처음부터 다시 만듦") {
+        REQUIRE(LineIndex::build(path, 7)->save());
+        {
+            std::ofstream file(path, std::ios::trunc);
+            for (int i = 1; i <= 150; ++i) {
+                file << "rewritten " << i << "\n";
+            }
+        }
+
+        auto rebuilt = LineIndex::loadOrBuild(path, 5);
+        REQUIRE(rebuilt->getSampleInterval() == 5);
+        REQUIRE(rebuilt->getLineCount() == 150);
+    }
+
+    SECTION("손상된 sidecar") {
+        std::ofstream(LineIndex::sidecarPath(path), std::ios::trunc) << "garbage";
+        REQUIRE_FALSE(LineIndex::load(path).has_value());
+    }
+
+    removeWithSidecar(path);
+}
+
+TEST_CASE("LogFileReader 라인 범위 읽기", "[LineIndex]") {
+    // 표본 간격(4096)을 여러 번 넘는 파일
+    std::string path = writeLines(10000, false);
+    LogFileReader reader(path);
+    REQUIRE(reader.getLineCount() == 10000);
+    REQUIRE(std::filesystem::exists(LineIndex::sidecarPath(path)));
+
+    SECTION("표본 경계 전후") {
+        REQUIRE(reader.readLineRange(4096, 3) == std::vector<std::string>{"line 4096", "line 4097", "line 4098"});
+        REQUIRE(reader.readLineRange(1, 2) == std::vector<std::string>{"line 1", "line 2"});
+        REQUIRE(reader.readLineRange(8193, 1) == std::vector<std::string>{"line 8193"});
+    }
+
+    SECTION("파일 끝을 넘는 범위") {
+        REQUIRE(reader.readLineRange(9999, 10) == std::vector<std::string>{"line 9999", "line 10000"});
+        REQUIRE(reader.readLineRange(10001, 1).empty());
+        REQUIRE(reader.readLineRange(0, 1).empty());
+    }
+
+    SECTION("다른 reader 는 저장된 sidecar 재사용") {
+        LogFileReader other(path);
+        REQUIRE(other.readLineRange(5000, 1) == std::vector<std::string>{"line 5000"});
+    }
+
+    removeWithSidecar(path);
+}
+
+TEST_CASE("순차 읽기 중에 라인 인덱스 표본 수집", "[LineIndex]") {
+    std::string path = writeLines(10000, false);
+    auto expected = LineIndex::build(path);
+    std::filesystem::remove(LineIndex::sidecarPath(path));
+
+    for (ReadMode mode : {ReadMode::Stream, ReadMode::MemoryMapped}) {
+        LogFileReader reader(path, mode);
+        LineBatch lines;
+        while (reader.readLines(lines, 1000) > 0) {
+        }
+
+        // 끝까지 읽어도 sidecar 는 만들지 않고, 라인 범위 읽기 때 모아 둔 표본을 그대로 저장
+        REQUIRE_FALSE(std::filesystem::exists(LineIndex::sidecarPath(path)));
+        REQUIRE(reader.readLineRange(8193, 1) == std::vector<std::string>{"line 8193"});
+        auto saved = LineIndex::load(path);
+        REQUIRE(saved.has_value());
+        REQUIRE(saved->getLineCount() == 10000);
+        REQUIRE(saved->getSampleOffsets() == expected->getSampleOffsets());
+        std::filesystem::remove(LineIndex::sidecarPath(path));
+    }
+
+    SECTION("중간부터 읽으면 표본을 모으지 않음") {
+        LogFileReader reader(path);
+        REQUIRE(reader.seekTo(7));
+        while (reader.readNextLineView()) {
+        }
+        REQUIRE_FALSE(std::filesystem::exists(LineIndex::sidecarPath(path)));
+    }
+
+    SECTION("읽은 뒤 파일이 커지면 이어서 인덱싱") {
+        LogFileReader reader(path);
+        while (reader.readNextLineView()) {
+        }
+        std::ofstream(path, std::ios::app) << "\nline 10001\n";
+        REQUIRE(reader.getLineCount() == 10001);
+        REQUIRE(reader.readLineRange(10000, 2) == std::vector<std::string>{"line 10000", "line 10001"});
+    }
+
+    removeWithSidecar(path);
+}
@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../LineSplitter.hpp"
+#include "../LogFileReader.hpp"
+#include <fstream>
+#include <filesystem>
+#include <random>
+
+using namespace LogAnalyzer;
+
+namespace {
+
+std::string splitterTestPath() {
+    return std::filesystem::temp_directory_path() / "test_line_splitter.log";
+}
+
+} // namespace
+
+TEST_CASE("개행 탐색 구현별 결과 일치", "[LineSplitter]") {
+    // 개행 밀도가 다른 데이터를 여러 길이/시작 위치로 잘라 SIMD 블록 경계와 나머지 처리를 모두 거치게 함
+    std::mt19937 random(1234);
+    std::string data(1000, 'x');
+    for (auto& c : data) {
+        c = random() % 7 == 0 ? '\n' : static_cast<char>('a' + random() % 26);
+    }
+    data.replace(300, 200, std::string(200, 'y')); // 개행 없는 긴 구간
+
+    for (std::size_t start : {0, 1, 15, 33}) {
+        for (std::size_t size : {0, 1, 16, 31, 32, 63, 64, 65, 129, 600}) {
+            std::vector<std::size_t> scalar;
+            std::size_t found = findNewlines(data.data() + start, size, 100, scalar, SplitBackend::Scalar);
+            REQUIRE(found == scalar.size());
+
+            for (SplitBackend backend : {SplitBackend::Sse2, SplitBackend::Avx2}) {
+                std::vector<std::size_t> offsets;
+                REQUIRE(findNewlines(data.data() + start, size, 100, offsets, backend) == found);
+                REQUIRE(offsets == scalar);
+            }
+        }
+    }
+
+    std::vector<std::size_t> offsets;
+    findNewlines("a\nbc\n\nd", 7, 0, offsets);
+    REQUIRE(offsets == std::vector<std::size_t>{1, 4, 5});
+    REQUIRE(stripCarriageReturn("line\r") == "line");
+    REQUIRE(stripCarriageReturn("\r") == "");
+    REQUIRE(stripCarriageReturn("li\rne") == "li\rne");
+}
+
+TEST_CASE("CRLF 파일을 모든 읽기 방식에서 같은 라인으로 읽음", "[LineSplitter]") {
+    std::string path = splitterTestPath();
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "2023-12-01 10:00:00 ERROR a\r\n\r\n2023-12-01 10:00:01 INFO b\r\nlast\r";
+    }
+    std::vector<std::string> expected{"2023-12-01 10:00:00 ERROR a", "", "2023-12-01 10:00:01 INFO b", "last"};
+
+    SECTION("Stream/MemoryMapped/AsyncRead") {
+        for (ReadMode mode : {ReadMode::Stream, ReadMode::MemoryMapped, ReadMode::AsyncRead}) {
+            LogFileReader reader(path, mode);
+            REQUIRE(reader.readAllLines() == expected);
+        }
+    }
+
+    SECTION("읽기 위치는 '\\r' 을 포함한 원본 바이트 기준") {
+        LogFileReader reader(path);
+        REQUIRE(reader.readNextLineView() == std::optional<std::string_view>(expected[0]));
+        REQUIRE(reader.getReadOffset() == expected[0].size() + 2);
+    }
+
+    SECTION("구간 분할과 역방향 읽기") {
+        LogFileReader reader(path);
+        std::vector<std::string> merged;
+        for (const auto& chunk : reader.splitIntoChunks(3)) {
+            auto lines = reader.readChunkLines(chunk);
+            merged.insert(merged.end(), lines.begin(), lines.end());
+        }
+        REQUIRE(merged == expected);
+        REQUIRE(reader.readLastLines(4) == expected);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("읽기 블록보다 긴 라인", "[LineSplitter]") {
+    std::string path = splitterTestPath();
+    std::string longLine(600 * 1024, 'z');
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << "short\n" << longLine << "\nend\n";
+    }
+
+    for (ReadMode mode : {ReadMode::Stream, ReadMode::MemoryMapped}) {
+        LogFileReader reader(path, mode);
+        REQUIRE(reader.readAllLines() == std::vector<std::string>{"short", longLine, "end"});
+    }
+
+    std::filesystem::remove(path);
+}
@@ -1,28 +1,14 @@
 #include <catch2/catch_test_macros.hpp>
 #include "../LogFileReader.hpp"
+#include "TestFileHelper.hpp"
 #include <fstream>
 #include <filesystem>
+#include <iterator>
+#include <cstdio>
+#include <unistd.h>
 
 using namespace LogAnalyzer;
 
-// 테스트용 임시 파일 생성 헬퍼 함수
-class TestFileHelper {
-public:
-    static std::string createTempFile(const std::string& content) {
-        std::string tempPath = std::filesystem::temp_directory_path() / "test_log.txt";
-        std::ofstream file(tempPath);
-        file << content;
-        file.close();
-        return tempPath;
-    }
-    
-    static void deleteTempFile(const std::string& path) {
-        if (std::filesystem::exists(path)) {
-            std::filesystem::remove(path);
-        }
-    }
-};
-
 TEST_CASE("LogFileReader 기본 기능 테스트", "[LogFileReader]") {
     SECTION("유효한 파일 읽기") {
         std::string testContent = "Line 1\nLine 2\nLine 3\n";
@@ -128,4 +114,502 @@ TEST_CASE("LogFileReader 대용량 파일 시뮬레이션", "[LogFileReader]") {
     }
     
     TestFileHelper::deleteTempFile(tempFile);
-} 
\ No newline at end of file
+} 
+TEST_CASE("LogFileReader 메모리 매핑 모드 테스트", "[LogFileReader]") {
+    std::string testContent = "First line\nSecond line\n\nLast line without newline";
+    std::string tempFile = TestFileHelper::createTempFile(testContent);
+    
+    SECTION("뷰 단위 순차 읽기") {
+        LogFileReader reader(tempFile, ReadMode::MemoryMapped);
+        REQUIRE(reader.isValid());
+        REQUIRE(reader.getReadMode() == ReadMode::MemoryMapped);
+        
+        auto line1 = reader.readNextLineView();
+        REQUIRE(line1.has_value());
+        REQUIRE(*line1 == "First line");
+        
+        auto line2 = reader.readNextLineView();
+        REQUIRE(line2.has_value());
+        REQUIRE(*line2 == "Second line");
+        
+        auto line3 = reader.readNextLineView();
+        REQUIRE(line3.has_value());
+        REQUIRE(line3->empty());
+        
+        auto line4 = reader.readNextLineView();
+        REQUIRE(line4.has_value());
+        REQUIRE(*line4 == "Last line without newline");
+        
+        REQUIRE_FALSE(reader.readNextLineView().has_value());
+        
+        // 이전에 받은 뷰는 reader 가 살아있는 동안 계속 유효
+        REQUIRE(*line1 == "First line");
+    }
+    
+    SECTION("Stream 모드와 동일한 결과") {
+        LogFileReader streamReader(tempFile);
+        LogFileReader mappedReader(tempFile, ReadMode::MemoryMapped);
+        
+        auto streamLines = streamReader.readAllLines();
+        auto mappedLines = mappedReader.readAllLines();
+        REQUIRE(mappedLines == streamLines);
+        
+        auto views = mappedReader.readAllLineViews();
+        REQUIRE(views.size() == streamLines.size());
+        for (std::size_t i = 0; i < views.size(); ++i) {
+            REQUIRE(views[i] == streamLines[i]);
+        }
+    }
+    
+    SECTION("readNextLine 도 매핑 영역에서 읽음") {
+        LogFileReader reader(tempFile, ReadMode::MemoryMapped);
+        auto line = reader.readNextLine();
+        REQUIRE(line.has_value());
+        REQUIRE(line.value() == "First line");
+    }
+    
+    TestFileHelper::deleteTempFile(tempFile);
+}
+
+TEST_CASE("LogFileReader 메모리 매핑 모드 경계값 테스트", "[LogFileReader]") {
+    SECTION("빈 파일") {
+        std::string tempFile = TestFileHelper::createTempFile("");
+        
+        LogFileReader reader(tempFile, ReadMode::MemoryMapped);
+        REQUIRE(reader.isValid());
+        REQUIRE_FALSE(reader.readNextLineView().has_value());
+        REQUIRE(reader.readAllLineViews().empty());
+        
+        TestFileHelper::deleteTempFile(tempFile);
+    }
+    
+    SECTION("존재하지 않는 파일") {
+        LogFileReader reader("/non/existent/file.txt", ReadMode::MemoryMapped);
+        REQUIRE_FALSE(reader.isValid());
+        REQUIRE_FALSE(reader.readNextLineView().has_value());
+    }
+    
+    SECTION("Stream 모드의 뷰 읽기") {
+        std::string tempFile = TestFileHelper::createTempFile("A\nB\n");
+        
+        LogFileReader reader(tempFile);
+        auto first = reader.readNextLineView();
+        REQUIRE(first.has_value());
+        REQUIRE(*first == "A");
+        auto second = reader.readNextLineView();
+        REQUIRE(second.has_value());
+        REQUIRE(*second == "B");
+        REQUIRE_FALSE(reader.readNextLineView().has_value());
+        
+        // 전체 뷰 읽기는 매핑 모드 전용
+        REQUIRE(reader.readAllLineViews().empty());
+        
+        TestFileHelper::deleteTempFile(tempFile);
+    }
+}
+
+TEST_CASE("LogFileReader 라인 경계 구간 분할 테스트", "[LogFileReader]") {
+    std::string testContent;
+    const int lineCount = 1000;
+    for (int i = 1; i <= lineCount; ++i) {
+        testContent += "Log line " + std::to_string(i) + "\n";
+    }
+    std::string tempFile = TestFileHelper::createTempFile(testContent);
+    
+    LogFileReader reader(tempFile);
+    REQUIRE(reader.isValid());
+    
+    SECTION("구간은 파일 전체를 빈틈없이 덮고 라인 경계에서 나뉨") {
+        auto chunks = reader.splitIntoChunks(7);
+        REQUIRE(chunks.size() == 7);
+        
+        std::uintmax_t expectedOffset = 0;
+        for (const auto& chunk : chunks) {
+            REQUIRE(chunk.offset == expectedOffset);
+            REQUIRE(chunk.length > 0);
+            REQUIRE(testContent[chunk.offset + chunk.length - 1] == '\n');
+            expectedOffset += chunk.length;
+        }
+        REQUIRE(expectedOffset == testContent.size());
+    }
+    
+    SECTION("라인 번호 prefix sum 이 정확함") {
+        auto chunks = reader.splitIntoChunks(4);
+        
+        std::size_t expectedLine = 1;
+        std::vector<std::string> merged;
+        for (const auto& chunk : chunks) {
+            REQUIRE(chunk.firstLineNumber == expectedLine);
+            reader.forEachLineInChunk(chunk, [&](std::string_view line, std::size_t lineNumber) {
+                REQUIRE(lineNumber == expectedLine);
+                REQUIRE(line == "Log line " + std::to_string(lineNumber));
+                merged.emplace_back(line);
+                ++expectedLine;
+            });
+            REQUIRE(expectedLine == chunk.firstLineNumber + chunk.lineCount);
+        }
+        
+        REQUIRE(merged == reader.readAllLines());
+    }
+    
+    SECTION("구간 수가 1 이하이면 전체 파일 하나") {
+        auto chunks = reader.splitIntoChunks(0);
+        REQUIRE(chunks.size() == 1);
+        REQUIRE(chunks[0].length == testContent.size());
+        REQUIRE(chunks[0].lineCount == lineCount);
+        REQUIRE(reader.readChunkLines(chunks[0]).size() == lineCount);
+    }
+    
+    TestFileHelper::deleteTempFile(tempFile);
+}
+
+TEST_CASE("LogFileReader 구간 분할 경계값 테스트", "[LogFileReader]") {
+    SECTION("빈 파일은 구간이 없음") {
+        std::string tempFile = TestFileHelper::createTempFile("");
+        LogFileReader reader(tempFile);
+        REQUIRE(reader.splitIntoChunks(4).empty());
+        TestFileHelper::deleteTempFile(tempFile);
+    }
+    
+    SECTION("긴 라인이 여러 분할 지점을 덮으면 구간이 줄어듦") {
+        std::string testContent = std::string(1000, 'x') + "\nshort\n";
+        std::string tempFile = TestFileHelper::createTempFile(testContent);
+        LogFileReader reader(tempFile);
+        
+        auto chunks = reader.splitIntoChunks(8);
+        REQUIRE(chunks.size() == 2);
+        REQUIRE(chunks[0].lineCount == 1);
+        REQUIRE(chunks[1].firstLineNumber == 2);
+        REQUIRE(reader.readChunkLines(chunks[1]) == std::vector<std::string>{"short"});
+        
+        TestFileHelper::deleteTempFile(tempFile);
+    }
+    
+    SECTION("개행 없이 끝나는 마지막 라인") {
+        std::string tempFile = TestFileHelper::createTempFile("A\nB\nC");
+        LogFileReader reader(tempFile);
+        
+        auto chunks = reader.splitIntoChunks(3);
+        std::size_t total = 0;
+        std::vector<std::string> merged;
+        for (const auto& chunk : chunks) {
+            total += chunk.lineCount;
+            auto lines = reader.readChunkLines(chunk);
+            merged.insert(merged.end(), lines.begin(), lines.end());
+        }
+        REQUIRE(total == 3);
+        REQUIRE(merged == std::vector<std::string>{"A", "B", "C"});
+        
+        TestFileHelper::deleteTempFile(tempFile);
+    }
+}
+
+TEST_CASE("LogFileReader 라인 묶음 읽기", "[LogFileReader]") {
+    SECTION("스트림과 메모리 매핑에서 동일") {
+        std::string tempFile = TestFileHelper::createTempFile("alpha\nbeta\n\ngamma\ndelta");
+        
+        for (ReadMode mode : {ReadMode::Stream, ReadMode::MemoryMapped}) {
+            LogFileReader reader(tempFile, mode);
+            REQUIRE(reader.isValid());
+            LineBatch batch;
+            
+            REQUIRE(reader.readLines(batch, 3) == 3);
+            REQUIRE(batch.size() == 3);
+            REQUIRE(batch[0] == "alpha");
+            REQUIRE(batch[1] == "beta");
+            REQUIRE(batch[2].empty());
+            REQUIRE(batch.bytes() == "alphabeta");
+        
+            // 이전 내용은 지워지고 남은 라인만 채워짐
+            REQUIRE(reader.readLines(batch, 3) == 2);
+            REQUIRE(batch[0] == "gamma");
+            REQUIRE(batch[1] == "delta");
+            REQUIRE_FALSE(reader.isLastLineTerminated());
+            
+            REQUIRE(reader.readLines(batch, 3) == 0);
+            REQUIRE(batch.empty());
+        }
+        
+        TestFileHelper::deleteTempFile(tempFile);
+    }
+    
+    SECTION("용량 재사용") {
+        std::string content;
+        for (int i = 0; i < 100; ++i) {
+            content += "line " + std::to_string(i % 10) + "\n";
+        }
+        std::string bigFile = TestFileHelper::createTempFile(content);
+        LogFileReader reader(bigFile);
+        LineBatch batch;
+        
+        REQUIRE(reader.readLines(batch, 10) == 10);
+        const char* buffer = batch.bytes().data();
+        while (reader.readLines(batch, 10) > 0) {
+            REQUIRE(batch.size() == 10);
+            REQUIRE(batch.bytes().data() == buffer);
+        }
+        
+        TestFileHelper::deleteTempFile(bigFile);
+    }
+}
+
+TEST_CASE("LogFileReader 표준 입력 스트리밍", "[LogFileReader]") {
+    // 표준 입력을 파이프로 바꿔 끼우고 끝나면 복구
+    std::string content = "Line 1\r\nLine 2\n\nLast";
+    int pipeFds[2];
+    REQUIRE(::pipe(pipeFds) == 0);
+    REQUIRE(::write(pipeFds[1], content.data(), content.size()) == static_cast<ssize_t>(content.size()));
+    ::close(pipeFds[1]);
+    int savedStdin = ::dup(STDIN_FILENO);
+    ::dup2(pipeFds[0], STDIN_FILENO);
+    ::close(pipeFds[0]);
+    
+    {
+        LogFileReader reader(LogFileReader::STDIN_PATH, ReadMode::MemoryMapped);
+        REQUIRE(reader.isValid());
+        REQUIRE(reader.isStandardInput());
+        REQUIRE(reader.getReadMode() == ReadMode::Stream);
+        REQUIRE(reader.getFileSize() == 0);
+        REQUIRE(reader.splitIntoChunks(4).empty());
+        
+        REQUIRE(reader.readNextLineView() == std::optional<std::string_view>("Line 1"));
+        REQUIRE(reader.getFileSize() == 8); // CRLF 의 '\r' 도 읽은 크기에 포함
+        
+        REQUIRE(reader.readAllLines() == std::vector<std::string>{"Line 2", "", "Last"});
+        REQUIRE_FALSE(reader.readNextLine().has_value());
+        REQUIRE(reader.getFileSize() == content.size());
+    }
+    
+    ::dup2(savedStdin, STDIN_FILENO);
+    ::close(savedStdin);
+}
+
+#ifdef LOG_ANALYZER_HAS_ZLIB
+#include <zlib.h>
+
+namespace {
+
+// 각 문자열을 별도의 gzip 멤버로 이어 붙여 저장
+std::string createGzipFile(const std::vector<std::string>& members) {
+    std::string path = std::filesystem::temp_directory_path() / "test_log.txt.gz";
+    std::filesystem::remove(path);
+    for (const auto& content : members) {
+        gzFile file = gzopen(path.c_str(), "ab");
+        gzwrite(file, content.data(), static_cast<unsigned>(content.size()));
+        gzclose(file);
+    }
+    return path;
+}
+
+} // namespace
+
+TEST_CASE("LogFileReader gzip 입력 테스트", "[LogFileReader]") {
+    std::string content;
+    for (int i = 1; i <= 50000; ++i) {
+        content += "2023-12-01 10:30:15 INFO gzip line " + std::to_string(i) + "\n";
+    }
+    std::string path = createGzipFile({content, "tail line 1\ntail line 2"});
+    
+    LogFileReader reader(path);
+    REQUIRE(reader.isValid());
+    REQUIRE(reader.isCompressed());
+    REQUIRE(reader.getCompression() == Compression::Gzip);
+    
+    SECTION("순차 읽기") {
+        auto first = reader.readNextLine();
+        REQUIRE(first.has_value());
+        REQUIRE(first.value() == "2023-12-01 10:30:15 INFO gzip line 1");
+    }
+    
+    SECTION("여러 멤버를 이어서 전체 읽기, 다시 읽어도 동일") {
+        auto lines = reader.readAllLines();
+        REQUIRE(lines.size() == 50002);
+        REQUIRE(lines[49999] == "2023-12-01 10:30:15 INFO gzip line 50000");
+        REQUIRE(lines[50001] == "tail line 2");
+        REQUIRE_FALSE(reader.hasReadError());
+        
+        REQUIRE(reader.readAllLines() == lines);
+    }
+    
+    SECTION("잘리거나 손상된 파일은 EOF 가 아니라 읽기 오류") {
+        std::ifstream original(path, std::ios::binary);
+        std::string compressed((std::istreambuf_iterator<char>(original)), std::istreambuf_iterator<char>());
+        std::string brokenPath = TestFileHelper::createTempFile(compressed.substr(0, compressed.size() / 2),
+                                                                "test_log_broken.txt.gz");
+        LogFileReader truncated(brokenPath);
+        REQUIRE(truncated.isValid());
+        REQUIRE(truncated.readAllLines().size() < 50002);
+        REQUIRE(truncated.hasReadError());
+        
+        std::string corrupted = compressed;
+        for (std::size_t i = 100; i < 200; ++i) {
+            corrupted[i] = static_cast<char>(~corrupted[i]);
+        }
+        TestFileHelper::writeFile(brokenPath, corrupted);
+        LogFileReader damaged(brokenPath);
+        REQUIRE(damaged.isValid());
+        damaged.readAllLines();
+        REQUIRE(damaged.hasReadError());
+        
+        std::filesystem::remove(brokenPath);
+    }
+    
+    SECTION("매핑 모드를 요청해도 스트림으로 풀어서 읽음") {
+        LogFileReader mappedReader(path, ReadMode::MemoryMapped);
+        REQUIRE(mappedReader.isValid());
+        REQUIRE(mappedReader.getReadMode() == ReadMode::Stream);
+        REQUIRE(mappedReader.readAllLines().size() == 50002);
+    }
+    
+    SECTION("압축 파일은 구간 분할 불가") {
+        REQUIRE(reader.splitIntoChunks(4).empty());
+    }
+    
+    std::filesystem::remove(path);
+}
+#endif
+
+TEST_CASE("LogFileReader 타임스탬프 이분 탐색", "[LogFileReader]") {
+    // 초마다 한 라인, 가끔 타임스탬프 없는 연속 라인
+    std::string content;
+    for (int minute = 0; minute < 10; ++minute) {
+        for (int second = 0; second < 60; second += 10) {
+            char stamp[32];
+            std::snprintf(stamp, sizeof(stamp), "2023-12-01 14:%02d:%02d", minute, second);
+            content += std::string(stamp) + " INFO tick\n";
+            if (second == 50) {
+                content += "    continuation\n";
+            }
+        }
+    }
+    std::string tempFile = TestFileHelper::createTempFile(content);
+    LogFileReader reader(tempFile);
+    
+    auto linesIn = [&](const FileChunk& range) {
+        return reader.readChunkLines(range);
+    };
+    
+    SECTION("구간 시작과 끝") {
+        auto lines = linesIn(reader.findTimeRange("2023-12-01 14:03:00", "2023-12-01 14:05"));
+        REQUIRE(lines.size() == 14);
+        REQUIRE(lines.front() == "2023-12-01 14:03:00 INFO tick");
+        REQUIRE(lines[lines.size() - 2] == "2023-12-01 14:04:50 INFO tick");
+        REQUIRE(lines.back() == "    continuation");
+    }
+    
+    SECTION("사이 값은 다음 타임스탬프부터") {
+        auto lines = linesIn(reader.findTimeRange("2023-12-01 14:02:55", "2023-12-01 14:03:15"));
+        REQUIRE(lines == std::vector<std::string>{"2023-12-01 14:03:00 INFO tick", "2023-12-01 14:03:10 INFO tick"});
+    }
+    
+    SECTION("한쪽만 지정하거나 범위를 벗어남") {
+        FileChunk all = reader.findTimeRange("", "");
+        REQUIRE(all.offset == 0);
+        REQUIRE(all.length == content.size());
+        
+        REQUIRE(linesIn(reader.findTimeRange("2023-12-01 14:09:50", "")).size() == 2);
+        REQUIRE(linesIn(reader.findTimeRange("", "2023-12-01 14:00:10")).size() == 1);
+        REQUIRE(reader.findTimeRange("2023-12-02", "").length == 0);
+        REQUIRE(reader.findTimeRange("", "2023-12-01 13").length == 0);
+    }
+    
+    TestFileHelper::deleteTempFile(tempFile);
+}
+
+TEST_CASE("LogFileReader 역방향 읽기", "[LogFileReader]") {
+    SECTION("블록 경계에 걸친 라인과 빈 라인") {
+        std::string tempFile = TestFileHelper::createTempFile("first\n\nthird line\nfourth\nlast line here\n");
+        LogFileReader reader(tempFile);
+        
+        // 블록이 라인보다 작아도 순서와 내용이 같아야 함
+        for (std::size_t blockSize : {std::size_t(1), std::size_t(4), std::size_t(7), std::size_t(1024)}) {
+            std::vector<std::string> lines;
+            reader.forEachLineReverse([&lines](std::string_view line) {
+                lines.emplace_back(line);
+                return true;
+            }, blockSize);
+            REQUIRE(lines == std::vector<std::string>{"last line here", "fourth", "third line", "", "first"});
+        }
+        
+        TestFileHelper::deleteTempFile(tempFile);
+    }
+    
+    SECTION("개행 없이 끝나는 파일과 개행만 있는 파일") {
+        std::string tempFile = TestFileHelper::createTempFile("a\nb");
+        REQUIRE(LogFileReader(tempFile).readLastLines(5) == std::vector<std::string>{"a", "b"});
+        
+        tempFile = TestFileHelper::createTempFile("\n\n");
+        REQUIRE(LogFileReader(tempFile).readLastLines(5) == std::vector<std::string>{"", ""});
+        
+        tempFile = TestFileHelper::createTempFile("");
+        REQUIRE(LogFileReader(tempFile).readLastLines(5).empty());
+        TestFileHelper::deleteTempFile(tempFile);
+    }
+    
+    SECTION("필요한 만큼만 읽고 멈춤") {
+        std::string content;
+        for (int i = 1; i <= 1000; ++i) {
+            content += "line " + std::to_string(i) + "\n";
+        }
+        std::string tempFile = TestFileHelper::createTempFile(content);
+        LogFileReader reader(tempFile);
+        
+        REQUIRE(reader.readLastLines(3) == std::vector<std::string>{"line 998", "line 999", "line 1000"});
+        
+        std::size_t visited = 0;
+        reader.forEachLineReverse([&visited](std::string_view) {
+            return ++visited < 10;
+        }, 64);
+        REQUIRE(visited == 10);
+        
+        TestFileHelper::deleteTempFile(tempFile);
+    }
+}
+
+TEST_CASE("LogFileReader 표본 블록 선택", "[LogFileReader]") {
+    // "line 1\n" ~ "line 200\n" 은 블록 경계(64바이트)에 걸치는 라인이 많음
+    std::string testContent;
+    std::vector<std::string> expected;
+    for (int i = 1; i <= 200; ++i) {
+        expected.push_back("line " + std::to_string(i));
+        testContent += expected.back() + "\n";
+    }
+    std::string tempFile = TestFileHelper::createTempFile(testContent);
+    LogFileReader reader(tempFile);
+    
+    SECTION("모든 블록을 고르면 파일 전체와 같음") {
+        std::vector<std::string> merged;
+        for (const auto& chunk : reader.sampleBlocks(1.0, 42, 64)) {
+            auto lines = reader.readChunkLines(chunk);
+            merged.insert(merged.end(), lines.begin(), lines.end());
+        }
+        REQUIRE(merged == expected);
+    }
+    
+    SECTION("일부 블록은 오프셋 순이고 라인 경계에 맞춰짐") {
+        auto chunks = reader.sampleBlocks(0.25, 7, 64);
+        std::size_t blockCount = (testContent.size() + 63) / 64;
+        REQUIRE(chunks.size() <= (blockCount + 3) / 4);
+        REQUIRE(chunks.size() >= (blockCount + 3) / 4 - 1);
+        
+        for (std::size_t i = 0; i < chunks.size(); ++i) {
+            if (i > 0) {
+                REQUIRE(chunks[i].offset >= chunks[i - 1].offset + chunks[i - 1].length);
+            }
+            for (const auto& line : reader.readChunkLines(chunks[i])) {
+                REQUIRE(line.rfind("line ", 0) == 0);
+            }
+        }
+        
+        // 같은 시드는 같은 블록
+        auto again = reader.sampleBlocks(0.25, 7, 64);
+        REQUIRE(again.size() == chunks.size());
+        REQUIRE(again.front().offset == chunks.front().offset);
+    }
+    
+    SECTION("비율이 0 이면 구간 없음") {
+        REQUIRE(reader.sampleBlocks(0.0, 1, 64).empty());
+    }
+    
+    TestFileHelper::deleteTempFile(tempFile);
+}
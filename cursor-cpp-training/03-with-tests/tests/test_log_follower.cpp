@@ -0,0 +1,151 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../LogFollower.hpp"
+#include "TestFileHelper.hpp"
+#include <fstream>
+#include <filesystem>
+
+using namespace LogAnalyzer;
+
+namespace {
+
+std::string followTestPath() {
+    return std::filesystem::temp_directory_path() / "test_follow_log.txt";
+}
+
+} // namespace
+
+TEST_CASE("LogFollower 추가된 라인만 읽기", "[LogFollower]") {
+    std::string path = followTestPath();
+    TestFileHelper::writeFile(path, "Line 1\nLine 2\n");
+    
+    LogFollower follower(path);
+    REQUIRE(follower.isValid());
+    REQUIRE(follower.getFilePath() == path);
+    
+    SECTION("기존 내용 후 새 내용") {
+        auto initial = follower.readAvailableLines();
+        REQUIRE(initial == std::vector<std::string>{"Line 1", "Line 2"});
+        
+        // 변경이 없으면 빈 결과
+        REQUIRE(follower.readAvailableLines().empty());
+        
+        TestFileHelper::appendFile(path, "Line 3\nLine 4\n");
+        auto appended = follower.readAvailableLines();
+        REQUIRE(appended == std::vector<std::string>{"Line 3", "Line 4"});
+    }
+    
+    SECTION("쓰는 중인 라인은 개행이 들어올 때까지 보류") {
+        follower.readAvailableLines();
+        
+        TestFileHelper::appendFile(path, "Partial");
+        REQUIRE(follower.readAvailableLines().empty());
+        
+        TestFileHelper::appendFile(path, " line\nNext\n");
+        auto lines = follower.readAvailableLines();
+        REQUIRE(lines == std::vector<std::string>{"Partial line", "Next"});
+    }
+    
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("LogFollower 변경 대기", "[LogFollower]") {
+    std::string path = followTestPath();
+    TestFileHelper::writeFile(path, "");
+    
+    LogFollower follower(path);
+    REQUIRE(follower.isValid());
+    follower.readAvailableLines();
+    
+#ifdef __linux__
+    SECTION("추가 후에는 알림을 받음") {
+        TestFileHelper::appendFile(path, "New line\n");
+        REQUIRE(follower.waitForChanges(std::chrono::milliseconds(1000)));
+        REQUIRE(follower.readAvailableLines() == std::vector<std::string>{"New line"});
+    }
+    
+    SECTION("변경이 없으면 타임아웃") {
+        REQUIRE_FALSE(follower.waitForChanges(std::chrono::milliseconds(10)));
+    }
+#endif
+    
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("LogFollower 존재하지 않는 파일", "[LogFollower]") {
+    LogFollower follower("/non/existent/follow.log");
+    REQUIRE_FALSE(follower.isValid());
+    REQUIRE(follower.readAvailableLines().empty());
+}
+
+TEST_CASE("LogFollower 로그 로테이션 처리", "[LogFollower]") {
+    std::string path = followTestPath();
+    std::string rotatedPath = path + ".1";
+    TestFileHelper::writeFile(path, "A\nB\n");
+    
+    LogFollower follower(path);
+    REQUIRE(follower.isValid());
+    REQUIRE(follower.readAvailableLines() == std::vector<std::string>{"A", "B"});
+    
+    SECTION("rename + create: 이전 파일의 남은 라인 후 새 파일") {
+        TestFileHelper::appendFile(path, "C\n");
+        std::filesystem::rename(path, rotatedPath);
+        TestFileHelper::writeFile(path, "D\n");
+        
+        auto lines = follower.readAvailableLines();
+        REQUIRE(lines == std::vector<std::string>{"C", "D"});
+        REQUIRE(follower.getRotationCount() == 1);
+        
+        TestFileHelper::appendFile(path, "E\n");
+        REQUIRE(follower.readAvailableLines() == std::vector<std::string>{"E"});
+    }
+    
+    SECTION("rename 후 새 파일 생성 전에는 이전 파일을 계속 읽음") {
+        std::filesystem::rename(path, rotatedPath);
+        TestFileHelper::appendFile(rotatedPath, "C\n");
+        
+        REQUIRE(follower.readAvailableLines() == std::vector<std::string>{"C"});
+        REQUIRE(follower.getRotationCount() == 0);
+        
+        TestFileHelper::writeFile(path, "D\n");
+        REQUIRE(follower.readAvailableLines() == std::vector<std::string>{"D"});
+        REQUIRE(follower.getRotationCount() == 1);
+    }
+    
+    SECTION("이전 파일의 미완성 라인은 버리지 않음") {
+        TestFileHelper::appendFile(path, "partial");
+        REQUIRE(follower.readAvailableLines().empty());
+        
+        std::filesystem::rename(path, rotatedPath);
+        TestFileHelper::writeFile(path, "D\n");
+        REQUIRE(follower.readAvailableLines() == std::vector<std::string>{"partial", "D"});
+    }
+    
+    SECTION("copytruncate: 크기가 줄면 처음부터 다시 읽고 기존 라인은 중복되지 않음") {
+        TestFileHelper::writeFile(path, "X\n");
+        
+        auto lines = follower.readAvailableLines();
+        REQUIRE(lines == std::vector<std::string>{"X"});
+        REQUIRE(follower.getRotationCount() == 1);
+        
+        TestFileHelper::appendFile(path, "Y\n");
+        REQUIRE(follower.readAvailableLines() == std::vector<std::string>{"Y"});
+    }
+    
+    SECTION("copytruncate 후 폴링 전에 이전 위치보다 커져도 처음부터 다시 읽음") {
+        TestFileHelper::writeFile(path, "");
+        TestFileHelper::appendFile(path, "first line\nsecond line\n");
+        
+        auto lines = follower.readAvailableLines();
+        REQUIRE(lines == std::vector<std::string>{"first line", "second line"});
+        REQUIRE(follower.getRotationCount() == 1);
+    }
+    
+    SECTION("크기만 늘어나고 기존 내용이 같으면 이어서 읽음") {
+        TestFileHelper::appendFile(path, "C\n");
+        REQUIRE(follower.readAvailableLines() == std::vector<std::string>{"C"});
+        REQUIRE(follower.getRotationCount() == 0);
+    }
+    
+    std::filesystem::remove(path);
+    std::filesystem::remove(rotatedPath);
+}
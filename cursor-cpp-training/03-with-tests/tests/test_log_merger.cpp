@@ -0,0 +1,152 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../LogMerger.hpp"
+#include "TestFileHelper.hpp"
+#include <fstream>
+#include <filesystem>
+
+using namespace LogAnalyzer;
+
+namespace {
+
+std::filesystem::path mergeTestDir() {
+    return std::filesystem::temp_directory_path() / "test_log_merger";
+}
+
+std::string writeFile(const std::string& name, const std::string& content) {
+    std::string path = mergeTestDir() / name;
+    TestFileHelper::writeFile(path, content);
+    return path;
+}
+
+std::vector<std::string> originalLines(const std::vector<LogEntry>& entries) {
+    std::vector<std::string> lines;
+    for (const auto& entry : entries) {
+        lines.push_back(entry.originalLine);
+    }
+    return lines;
+}
+
+} // namespace
+
+TEST_CASE("LogMerger 타임스탬프 순 병합", "[LogMerger]") {
+    std::filesystem::create_directories(mergeTestDir());
+
+    std::string first = writeFile("app1.log",
+        "2023-12-01 10:00:00 INFO a1\n"
+        "2023-12-01 10:00:02 ERROR a2\n"
+        "  at stack frame\n"
+        "2023-12-01 10:00:05 INFO a3\n");
+    std::string second = writeFile("app2.log",
+        "2023-12-01 10:00:01 WARN b1\n"
+        "2023-12-01 10:00:02 INFO b2\n"
+        "2023-12-01 10:00:04 DEBUG b3\n");
+
+    SECTION("두 파일 병합") {
+        LogMerger merger({first, second});
+        REQUIRE(merger.isValid());
+
+        auto lines = originalLines(merger.mergeAll());
+        REQUIRE(lines == std::vector<std::string>{
+            "2023-12-01 10:00:00 INFO a1",
+            "2023-12-01 10:00:01 WARN b1",
+            "2023-12-01 10:00:02 ERROR a2",     // 같은 시각이면 앞선 파일 먼저
+            "  at stack frame",                 // 타임스탬프 없는 라인은 직전 라인을 따름
+            "2023-12-01 10:00:02 INFO b2",
+            "2023-12-01 10:00:04 DEBUG b3",
+            "2023-12-01 10:00:05 INFO a3",
+        });
+        REQUIRE_FALSE(merger.next().has_value());
+    }
+
+    SECTION("파일 크기 합계") {
+        LogMerger merger({first, second});
+        auto expected = std::filesystem::file_size(first) + std::filesystem::file_size(second);
+        REQUIRE(merger.getTotalFileSize() == expected);
+    }
+
+    SECTION("읽을 수 없는 파일은 건너뜀") {
+        std::string missing = (mergeTestDir() / "missing.log").string();
+        LogMerger merger({missing, second});
+        REQUIRE(merger.isValid());
+        REQUIRE(merger.mergeAll().size() == 3);
+
+        LogMerger none({missing});
+        REQUIRE_FALSE(none.isValid());
+        REQUIRE_FALSE(none.next().has_value());
+    }
+
+    SECTION("끝까지 읽지 않고 소멸") {
+        std::string contents;
+        for (int i = 0; i < 5000; ++i) {
+            contents += "2023-12-01 10:00:00 INFO filler\n";
+        }
+        std::string large = writeFile("large.log", contents);
+
+        LogMerger merger({large, first});
+        REQUIRE(merger.next().has_value());
+    }
+
+    SECTION("파일 수보다 적은 스레드로도 모든 파일을 병합") {
+        std::vector<std::string> files;
+        for (int i = 0; i < 40; ++i) {
+            std::string contents;
+            for (int second = 0; second < 600; ++second) {
+                // 파일마다 같은 초에 한 줄씩 쓰므로 병합 결과는 초 순서, 같은 초는 파일 순서
+                contents += "2023-12-01 10:" + std::string(second / 60 < 10 ? "0" : "") + std::to_string(second / 60) +
+                            ":" + (second % 60 < 10 ? "0" : "") + std::to_string(second % 60) +
+                            " INFO f" + std::to_string(i) + "\n";
+            }
+            files.push_back(writeFile("many" + std::to_string(i) + ".log", contents));
+        }
+
+        LogMerger merger(files, 2);
+        REQUIRE(merger.isValid());
+        auto entries = merger.mergeAll();
+        REQUIRE(entries.size() == 40 * 600);
+
+        std::size_t outOfOrder = 0;
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            std::string expectedSuffix = " INFO f" + std::to_string(i % 40);
+            const std::string& line = entries[i].originalLine;
+            if (line.size() < expectedSuffix.size() ||
+                line.compare(line.size() - expectedSuffix.size(), expectedSuffix.size(), expectedSuffix) != 0) {
+                ++outOfOrder;
+            }
+        }
+        REQUIRE(outOfOrder == 0);
+        REQUIRE_FALSE(merger.hasErrors());
+    }
+
+    std::filesystem::remove_all(mergeTestDir());
+}
+
+TEST_CASE("LogMerger 입력 경로 확장", "[LogMerger]") {
+    std::filesystem::create_directories(mergeTestDir() / "nested");
+    std::string b = writeFile("b.log", "x\n");
+    std::string a = writeFile("a.log", "x\n");
+    std::string txt = writeFile("c.txt", "x\n");
+    writeFile(".hidden", "x\n");
+
+    SECTION("디렉터리는 정렬된 일반 파일 목록") {
+        auto files = LogMerger::expandInputs({mergeTestDir().string()});
+        REQUIRE(files == std::vector<std::string>{a, b, txt});
+    }
+
+    SECTION("글롭 패턴") {
+        auto files = LogMerger::expandInputs({(mergeTestDir() / "*.log").string()});
+        REQUIRE(files == std::vector<std::string>{a, b});
+    }
+
+    SECTION("일반 경로는 그대로") {
+        auto files = LogMerger::expandInputs({b, a});
+        REQUIRE(files == std::vector<std::string>{b, a});
+    }
+
+    SECTION("디렉터리와 글롭이 겹치면 한 번만") {
+        auto files = LogMerger::expandInputs({mergeTestDir().string(), (mergeTestDir() / "*.log").string(),
+                                              (mergeTestDir() / "nested" / ".." / "a.log").string()});
+        REQUIRE(files == std::vector<std::string>{a, b, txt});
+    }
+
+    std::filesystem::remove_all(mergeTestDir());
+}
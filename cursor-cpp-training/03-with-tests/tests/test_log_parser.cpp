@@ -1,5 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
+#include <type_traits>
 #include "../LogParser.hpp"
+#include <regex>
 
 using namespace LogAnalyzer;
 
@@ -136,4 +138,367 @@ TEST_CASE("LogParser 문자열 변환 테스트", "[LogParser]") {
         REQUIRE(LogParser::stringToLogLevel("DEBUG") == LogLevel::DEBUG);
         REQUIRE(LogParser::stringToLogLevel("INVALID") == LogLevel::UNKNOWN);
     }
-} 
\ No newline at end of file
+} 
+TEST_CASE("LogParser 타임스탬프 스캐너", "[LogParser]") {
+    LogParser parser;
+    
+    SECTION("위치와 추출 결과") {
+        REQUIRE(LogParser::findTimestamp("2023-12-01 10:30:15 ERROR x") == 0);
+        REQUIRE(LogParser::findTimestamp("[app] 2023-12-01\t10:30:15 INFO") == 6);
+        REQUIRE(LogParser::findTimestamp("2023-12-01 10:30") == std::string_view::npos);
+        REQUIRE(LogParser::findTimestamp("") == std::string_view::npos);
+        REQUIRE(parser.extractTimestamp("id=12-2023-12-01 10:30:15") == "2023-12-01 10:30:15");
+        REQUIRE(parser.extractTimestamp("no timestamp here").empty());
+    }
+    
+    SECTION("기존 정규식과 같은 결과") {
+        // 예전 구현이 쓰던 패턴을 기준으로 비교
+        const std::regex timestampRegex(R"(\d{4}-\d{2}-\d{2}\s\d{2}:\d{2}:\d{2})");
+        std::vector<std::string> lines = {
+            "2023-12-01 10:30:15 ERROR Database connection failed",
+            "2023-12-01 10:30:15",
+            "x2023-12-01 10:30:15",
+            "12023-12-01 10:30:15",
+            "2023-12-01  10:30:15",
+            "2023-12-01T10:30:15",
+            "2023-1-01 10:30:15 2024-01-02 03:04:05",
+            "2023-12-01 10:30:1",
+            "----2023-12-01 10:30:15----",
+            "2023-12-01\r10:30:15",
+            "a-b-c-d 2023-12-0x 10:30:15 2023-12-01 10:30:15",
+            "9999-99-99 99:99:99",
+            "Some random log",
+            "",
+        };
+        for (const auto& line : lines) {
+            std::smatch match;
+            std::string expected = std::regex_search(line, match, timestampRegex) ? match.str() : "";
+            INFO(line);
+            REQUIRE(parser.extractTimestamp(line) == expected);
+            REQUIRE(parser.parseLine(line).timestamp == expected);
+        }
+    }
+}
+
+TEST_CASE("LogParser 에포크 밀리초 변환", "[LogParser]") {
+    LogParser parser;
+    
+    SECTION("UTC 기준 값") {
+        REQUIRE(LogParser::timestampToEpochMs("1970-01-01 00:00:00") == 0);
+        REQUIRE(LogParser::timestampToEpochMs("2023-12-01 10:30:15") == 1701426615000);
+        REQUIRE(LogParser::timestampToEpochMs("2024-02-29 23:59:59") == 1709251199000);
+        REQUIRE(LogParser::timestampToEpochMs("2000-03-01 00:00:00") == 951868800000);
+        REQUIRE(LogParser::timestampToEpochMs("1969-12-31 23:59:59") == -1000);
+    }
+    
+    SECTION("같은 시각 앞부분을 재사용해도 분/초는 라인마다 반영") {
+        REQUIRE(LogParser::timestampToEpochMs("2023-12-01 10:00:00") == 1701424800000);
+        REQUIRE(LogParser::timestampToEpochMs("2023-12-01 10:59:59") == 1701428399000);
+        REQUIRE(LogParser::timestampToEpochMs("2023-12-01 11:00:00") == 1701428400000);
+        REQUIRE(LogParser::timestampToEpochMs("2023-12-01 10:00:01") == 1701424801000);
+    }
+    
+    SECTION("달력상 틀린 값과 형식 오류") {
+        REQUIRE(LogParser::timestampToEpochMs("2023-02-29 00:00:00") == LogEntry::NO_EPOCH);
+        REQUIRE(LogParser::timestampToEpochMs("2023-13-01 00:00:00") == LogEntry::NO_EPOCH);
+        REQUIRE(LogParser::timestampToEpochMs("2023-12-01 24:00:00") == LogEntry::NO_EPOCH);
+        REQUIRE(LogParser::timestampToEpochMs("2023-12-01 23:60:00") == LogEntry::NO_EPOCH);
+        REQUIRE(LogParser::timestampToEpochMs("2023-12-01 23:00:60") == LogEntry::NO_EPOCH);
+        REQUIRE(LogParser::timestampToEpochMs("2023-12-01") == LogEntry::NO_EPOCH);
+    }
+    
+    SECTION("parseLine 이 함께 채움") {
+        auto entry = parser.parseLine("2023-12-01 10:30:15 ERROR Database connection failed");
+        REQUIRE(entry.hasEpoch());
+        REQUIRE(entry.epochMs == 1701426615000);
+        REQUIRE_FALSE(parser.parseLine("no timestamp").hasEpoch());
+    }
+}
+
+TEST_CASE("LogParser 레벨 토큰 감지", "[LogParser]") {
+    LogParser parser;
+    
+    SECTION("대소문자 무시와 구분 기호로 둘러싼 토큰") {
+        REQUIRE(parser.parseLine("2023-12-01 10:30:15 error disk full").level == LogLevel::ERROR);
+        REQUIRE(parser.parseLine("2023-12-01 10:30:15 [Warning] slow query").level == LogLevel::WARNING);
+        REQUIRE(parser.parseLine("2023-12-01 10:30:15 dbg: cache miss").level == LogLevel::DEBUG);
+        REQUIRE(parser.parseLine("2023-12-01 10:30:15 <ERR> timeout").level == LogLevel::ERROR);
+    }
+    
+    SECTION("라인에서 먼저 나오는 토큰이 결정") {
+        REQUIRE(parser.parseLine("2023-12-01 10:30:15 INFO retry after ERROR").level == LogLevel::INFO);
+        REQUIRE(parser.parseLine("2023-12-01 10:30:15 DEBUG payload contains WARN flag").level == LogLevel::DEBUG);
+    }
+    
+    SECTION("다른 단어 안에 포함된 레벨 문자열은 무시") {
+        REQUIRE(parser.parseLine("2023-12-01 10:30:15 Terrible weather").level == LogLevel::UNKNOWN);
+        REQUIRE(parser.parseLine("2023-12-01 10:30:15 Information about debugging").level == LogLevel::UNKNOWN);
+        REQUIRE(parser.parseLine("2023-12-01 10:30:15 WARNINGS suppressed").level == LogLevel::UNKNOWN);
+    }
+    
+    SECTION("SIMD 블록 경계와 나머지 바이트") {
+        // 16바이트 블록 경계에 걸치거나 마지막 나머지 구간에 있는 토큰
+        for (std::size_t pad = 0; pad < 40; ++pad) {
+            std::string line(pad, '.');
+            line += "Warning";
+            REQUIRE(parser.parseLine(line).level == LogLevel::WARNING);
+            REQUIRE(parser.parseLine(line + "s").level == LogLevel::UNKNOWN);
+            REQUIRE(parser.parseLine("x" + line.substr(pad)).level == LogLevel::UNKNOWN);
+        }
+    }
+}
+
+TEST_CASE("LogParser 정형 라인 빠른 경로", "[LogParser]") {
+    LogParser parser;
+    
+    SECTION("일반 경로와 같은 결과") {
+        std::vector<std::string> lines = {
+            "2023-12-01 09:00:00 INFO Application started successfully",
+            "2023-12-01 09:00:15 warn Configuration file permission is too open (644)",
+            "2023-12-01 09:00:30 ERROR Database connection timeout  ",
+            "2023-12-01 09:00:31 DBG\tcache miss",
+        };
+        for (const auto& line : lines) {
+            auto entry = parser.parseLine(line);
+            // 타임스탬프 앞에 공백을 붙이면 고정 위치가 맞지 않아 일반 경로로 처리됨
+            auto general = parser.parseLine(" " + line);
+            REQUIRE(entry.level == general.level);
+            REQUIRE(entry.timestamp == general.timestamp);
+            REQUIRE(entry.message == general.message);
+            REQUIRE(entry.epochMs == general.epochMs);
+        }
+        
+        auto stats = parser.fastPathStats();
+        REQUIRE(stats.lines == 8);
+        REQUIRE(stats.hits == 4);
+        REQUIRE(stats.hitRate() == 0.5);
+    }
+    
+    SECTION("형태가 다르면 일반 경로") {
+        std::vector<std::string> lines = {
+            "2023-12-01 09:00:00 Some random log",
+            "2023-12-01 09:00:00 INFO",
+            "2023-12-01 09:00:00 INFO:started",
+            "2023-12-01T09:00:00 INFO started",
+            "2023-12-01 09:00:00 INFORMATION started",
+            "",
+        };
+        auto entries = parser.parseLines(lines);
+        REQUIRE(entries[0].level == LogLevel::UNKNOWN);
+        REQUIRE(entries[1].level == LogLevel::INFO);
+        REQUIRE(entries[1].message == lines[1]);
+        REQUIRE(entries[2].level == LogLevel::INFO);
+        REQUIRE(parser.fastPathStats().lines == lines.size());
+        REQUIRE(parser.fastPathStats().hits == 0);
+    }
+    
+    SECTION("카운터 초기화") {
+        parser.parseLine("2023-12-01 09:00:00 INFO started");
+        REQUIRE(parser.fastPathStats().hits == 1);
+        parser.resetFastPathStats();
+        REQUIRE(parser.fastPathStats().lines == 0);
+        REQUIRE(parser.fastPathStats().hitRate() == 0.0);
+    }
+    
+    SECTION("복사/이동하면 그 시점의 카운터를 가져감") {
+        STATIC_REQUIRE(std::is_copy_constructible_v<LogParser>);
+        STATIC_REQUIRE(std::is_nothrow_move_assignable_v<LogParser>);
+        parser.parseLine("2023-12-01 09:00:00 INFO started");
+        parser.parseLine("no level");
+        
+        LogParser copy(parser);
+        REQUIRE(copy.fastPathStats().lines == 2);
+        REQUIRE(copy.fastPathStats().hits == 1);
+        copy.parseLine("2023-12-01 09:00:01 INFO again");
+        REQUIRE(parser.fastPathStats().lines == 2);
+        
+        LogParser moved;
+        moved = std::move(copy);
+        REQUIRE(moved.fastPathStats().lines == 3);
+        REQUIRE(moved.fastPathStats().hits == 2);
+    }
+}
+
+TEST_CASE("LogParser 메시지 위치 추출", "[LogParser]") {
+    LogParser parser;
+    
+    SECTION("레벨 토큰 뒤의 원본 그대로") {
+        auto entry = parser.parseLine("2023-12-01 09:00:00 ERROR Disk  /dev/sda1\tfull ");
+        REQUIRE(entry.message == "Disk  /dev/sda1\tfull");
+    }
+    
+    SECTION("레벨에 붙은 구분 기호") {
+        REQUIRE(parser.parseLine("2023-12-01 09:00:00 [WARN] slow query").message == "slow query");
+        REQUIRE(parser.parseLine("2023-12-01 09:00:00 ERROR: timeout").message == "timeout");
+        REQUIRE(parser.parseLine("<dbg> cache miss").message == "cache miss");
+    }
+    
+    SECTION("레벨이 없으면 타임스탬프 뒤") {
+        REQUIRE(parser.parseLine("2023-12-01 09:00:00 Some random log").message == "Some random log");
+        REQUIRE(parser.parseLine("INFO 2023-12-01 09:00:00 started").message == "started");
+    }
+    
+    SECTION("메시지가 없으면 원본 라인") {
+        REQUIRE(parser.parseLine("no level here").message == "no level here");
+        REQUIRE(parser.parseLine("2023-12-01 09:00:00 INFO ").message == "2023-12-01 09:00:00 INFO ");
+    }
+}
+
+TEST_CASE("LogParser 공유 버퍼 기반 compact 엔트리", "[LogParser]") {
+    LogParser parser;
+    STATIC_REQUIRE(sizeof(CompactLogEntry) <= 32);
+    
+    std::vector<std::string> lines = {
+        "2023-12-01 09:00:00 INFO Application started",
+        "2023-12-01 09:00:30 ERROR Database connection timeout",
+        "   continuation without level",
+        "WARN 2023-12-01 09:01:00 disk  almost full",
+    };
+    
+    auto makeBatch = [&parser](const std::vector<std::string>& source) {
+        LineBatch batch;
+        for (const auto& line : source) {
+            batch.append(line);
+        }
+        auto compact = parser.parseCompact(std::move(batch));
+        REQUIRE(batch.empty());
+        return compact;
+    };
+    
+    SECTION("parseLine 과 같은 결과") {
+        auto compact = makeBatch(lines);
+        REQUIRE(compact.size() == lines.size());
+        for (std::size_t i = 0; i < lines.size(); ++i) {
+            auto expected = parser.parseLine(lines[i]);
+            auto entry = compact.materialize(compact[i]);
+            REQUIRE(entry.originalLine == expected.originalLine);
+            REQUIRE(entry.level == expected.level);
+            REQUIRE(entry.timestamp == expected.timestamp);
+            REQUIRE(entry.message == expected.message);
+            REQUIRE(entry.epochMs == expected.epochMs);
+        }
+    }
+    
+    SECTION("이어 붙인 묶음과 거른 묶음은 원래 버퍼를 그대로 가리킴") {
+        CompactLogBatch all = makeBatch({lines[0], lines[1]});
+        std::string_view firstLine = all.line(all[0]);
+        all.append(makeBatch({lines[2], lines[3]}));
+        REQUIRE(all.size() == 4);
+        REQUIRE(all.line(all[0]).data() == firstLine.data());
+        for (std::size_t i = 0; i < lines.size(); ++i) {
+            REQUIRE(all.line(all[i]) == lines[i]);
+        }
+        
+        auto errors = parser.filterByLevel(all, LogLevel::ERROR);
+        REQUIRE(errors.size() == 1);
+        REQUIRE(errors.message(errors[0]) == "Database connection timeout");
+        
+        auto matches = parser.filterByKeyword(all, "disk");
+        REQUIRE(matches.size() == 1);
+        REQUIRE(matches.line(matches[0]).data() == all.line(all[3]).data());
+        REQUIRE(matches.timestamp(matches[0]) == "2023-12-01 09:01:00");
+
+        matches.retain([](const CompactLogEntry& entry) { return entry.level == LogLevel::ERROR; });
+        REQUIRE(matches.empty());
+        all.retain([](const CompactLogEntry& entry) { return entry.level != LogLevel::UNKNOWN; });
+        REQUIRE(all.size() == 3);
+        REQUIRE(all.line(all[2]) == lines[3]);
+    }
+}
+
+TEST_CASE("LogParser 병렬 파싱", "[LogParser]") {
+    LogParser parser;
+    ThreadPool pool(4);
+    
+    // 여러 구간으로 나뉘도록 PARALLEL_MIN_LINES 보다 훨씬 많은 라인
+    std::vector<std::string> lines;
+    const char* levels[] = {"INFO", "WARN", "ERROR", "DEBUG"};
+    for (std::size_t i = 0; i < LogParser::PARALLEL_MIN_LINES * 5 + 123; ++i) {
+        std::string line = "2023-12-01 10:00:00 " + std::string(levels[i % 4]) + " request " + std::to_string(i);
+        lines.push_back(i % 97 == 0 ? "untimed line " + std::to_string(i) : line);
+    }
+    
+    SECTION("입력 순서와 결과가 순차 파싱과 같음") {
+        auto serial = parser.parseLines(lines);
+        auto parallel = parser.parseLines(lines, pool);
+        REQUIRE(parallel.size() == serial.size());
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < serial.size(); ++i) {
+            mismatches += parallel[i].originalLine != serial[i].originalLine || parallel[i].level != serial[i].level ||
+                          parallel[i].message != serial[i].message || parallel[i].epochMs != serial[i].epochMs;
+        }
+        REQUIRE(mismatches == 0);
+        
+        // 구간마다 센 빠른 경로 카운터도 빠짐없이 합쳐짐
+        std::size_t untimed = (lines.size() + 96) / 97;
+        auto stats = parser.fastPathStats();
+        REQUIRE(stats.lines == lines.size() * 2);
+        REQUIRE(stats.hits == (lines.size() - untimed) * 2);
+    }
+    
+    SECTION("compact 묶음도 같은 결과") {
+        LineBatch batch;
+        for (const auto& line : lines) {
+            batch.append(line);
+        }
+        auto compact = parser.parseCompact(std::move(batch), pool);
+        REQUIRE(compact.size() == lines.size());
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < lines.size(); ++i) {
+            mismatches += compact.line(compact[i]) != lines[i] || compact[i].level != parser.parseLine(lines[i]).level;
+        }
+        REQUIRE(mismatches == 0);
+    }
+    
+    SECTION("적은 라인은 나누지 않음") {
+        std::vector<std::string> few(lines.begin(), lines.begin() + 10);
+        auto entries = parser.parseLines(few, pool);
+        REQUIRE(entries.size() == 10);
+        REQUIRE(entries[3].originalLine == few[3]);
+    }
+}
+
+TEST_CASE("LogParser 열 단위 ParsedBatch", "[LogParser]") {
+    LogParser parser;
+    
+    std::vector<std::string> lines = {
+        "2023-12-01 09:00:00 INFO Application started",
+        "2023-12-01 09:00:30 [ERROR] Database  timeout  ",
+        "no level here",
+        "",
+        "  2023-12-01 09:01:00 WARN",
+    };
+    LineBatch batch;
+    for (const auto& line : lines) {
+        batch.append(line);
+    }
+    
+    SECTION("parseLine 과 같은 값") {
+        ParsedBatch parsed;
+        parser.parseBatch(batch, parsed);
+        REQUIRE(parsed.size() == lines.size());
+        REQUIRE(parsed.lineOffset.size() == lines.size() + 1);
+        for (std::size_t i = 0; i < lines.size(); ++i) {
+            auto expected = parser.parseLine(lines[i]);
+            REQUIRE(parsed.levels[i] == expected.level);
+            REQUIRE(parsed.epochMs[i] == expected.epochMs);
+            REQUIRE(parsed.line(batch.bytes(), i) == lines[i]);
+            REQUIRE(parsed.message(batch.bytes(), i) == expected.message);
+        }
+    }
+    
+    SECTION("같은 묶음을 재사용하고 병렬로도 같은 결과") {
+        ParsedBatch serial;
+        parser.parseBatch(batch, serial);
+        parser.parseBatch(batch, serial);
+        REQUIRE(serial.size() == lines.size());
+        
+        ThreadPool pool(3);
+        ParsedBatch parallel;
+        parser.parseBatch(batch, parallel, pool);
+        REQUIRE(parallel.levels == serial.levels);
+        REQUIRE(parallel.epochMs == serial.epochMs);
+        REQUIRE(parallel.lineOffset == serial.lineOffset);
+        REQUIRE(parallel.msgOffset == serial.msgOffset);
+    }
+}
@@ -60,6 +60,12 @@ TEST_CASE("LogStats JSON 출력 테스트", "[LogStats]") {
     REQUIRE(json.find("/test/log.txt") != std::string::npos);
     REQUIRE(json.find("512") != std::string::npos);
     REQUIRE(json.find("3") != std::string::npos); // totalLines
+    REQUIRE(json.find("\"fileSizeKnown\": true") != std::string::npos);
+    
+    SECTION("크기를 미리 알 수 없는 스트림 입력") {
+        statistics.fileSizeKnown = false;
+        REQUIRE(stats.statsToJson(statistics).find("\"fileSizeKnown\": false") != std::string::npos);
+    }
 }
 
 TEST_CASE("LogStats 통계 출력 테스트", "[LogStats]") {
@@ -163,4 +169,171 @@ TEST_CASE("LogStats 키워드 매칭 출력 테스트", "[LogStats]") {
         
         REQUIRE(output.find("키워드를 포함한 로그가 없습니다") != std::string::npos);
     }
-} 
\ No newline at end of file
+} 
+TEST_CASE("LogStats 증분 통계 갱신 테스트", "[LogStats]") {
+    LogStats stats;
+    
+    std::vector<LogEntry> entries = {
+        LogEntry("Error message", LogLevel::ERROR),
+        LogEntry("Info message", LogLevel::INFO)
+    };
+    auto statistics = stats.calculateStats(entries);
+    
+    stats.updateStats(statistics, LogEntry("Another error", LogLevel::ERROR));
+    stats.updateStats(statistics, LogEntry("Debug message", LogLevel::DEBUG));
+    
+    REQUIRE(statistics.totalLines == 4);
+    REQUIRE(statistics.levelCounts[LogLevel::ERROR] == 2);
+    REQUIRE(statistics.levelCounts[LogLevel::INFO] == 1);
+    REQUIRE(statistics.levelCounts[LogLevel::DEBUG] == 1);
+    // 증분 갱신된 엔트리는 보관하지 않음
+    REQUIRE(statistics.entries.size() == 2);
+}
+
+TEST_CASE("LogStats compact 엔트리 통계", "[LogStats]") {
+    LogStats stats;
+    LogParser parser;
+    
+    LineBatch lines;
+    lines.append("2023-12-01 10:00:00 ERROR Disk \"sda\" failed");
+    lines.append("2023-12-01 10:00:01 INFO Started");
+    lines.append("2023-12-01 10:00:02 INFO Ready");
+    auto statistics = stats.calculateStats(parser.parseCompact(std::move(lines)), "/test/compact.log", 100);
+    
+    REQUIRE(statistics.totalLines == 3);
+    REQUIRE(statistics.levelCounts[LogLevel::ERROR] == 1);
+    REQUIRE(statistics.levelCounts[LogLevel::INFO] == 2);
+    REQUIRE(statistics.entries.empty());
+    REQUIRE(statistics.compactEntries.size() == 3);
+    REQUIRE(statistics.timeline.startMs == LogParser::timestampToEpochMs("2023-12-01 10:00:00"));
+    REQUIRE(statistics.timeline.counts == std::vector<std::size_t>{3});
+    
+    std::string json = stats.statsToJson(statistics);
+    REQUIRE(json.find("\"timestamp\": \"2023-12-01 10:00:00\"") != std::string::npos);
+    REQUIRE(json.find("Disk \\\"sda\\\" failed") != std::string::npos);
+    REQUIRE(json.find("2023-12-01 10:00:02 INFO Ready") != std::string::npos);
+}
+
+TEST_CASE("LogStats ParsedBatch 열 집계", "[LogStats]") {
+    LogStats stats;
+    LogParser parser;
+    
+    LineBatch lines;
+    lines.append("2023-12-01 10:00:05 ERROR Disk failed");
+    lines.append("2023-12-01 10:00:59 INFO Started");
+    lines.append("continuation without timestamp");
+    lines.append("2023-12-01 10:03:00 INFO Ready");
+    lines.append("2023-12-01 10:01:10 WARN Late arrival");
+    ParsedBatch parsed;
+    parser.parseBatch(lines, parsed);
+    
+    SECTION("레벨별 개수") {
+        auto counts = stats.countLevels(parsed);
+        REQUIRE(counts.size() == 4);
+        REQUIRE(counts[LogLevel::ERROR] == 1);
+        REQUIRE(counts[LogLevel::INFO] == 2);
+        REQUIRE(counts[LogLevel::WARNING] == 1);
+        REQUIRE(counts[LogLevel::UNKNOWN] == 1);
+    }
+    
+    SECTION("분 단위 시간 구간") {
+        auto histogram = stats.bucketByTime(parsed, 60 * 1000);
+        REQUIRE(histogram.startMs == LogParser::timestampToEpochMs("2023-12-01 10:00:00"));
+        REQUIRE(histogram.counts == std::vector<std::size_t>{2, 1, 0, 1});
+    }
+    
+    SECTION("타임스탬프가 없거나 간격이 잘못되면 빈 결과") {
+        LineBatch untimed;
+        untimed.append("no timestamp");
+        ParsedBatch none;
+        parser.parseBatch(untimed, none);
+        REQUIRE(stats.bucketByTime(none, 1000).counts.empty());
+        REQUIRE(stats.bucketByTime(parsed, 0).counts.empty());
+    }
+    
+    SECTION("동떨어진 시각이 있으면 간격을 넓혀 최대 개수 안에 맞춤") {
+        LineBatch outlier;
+        outlier.append("1970-01-01 00:00:00 INFO epoch");
+        outlier.append("2023-12-01 10:00:00 INFO now");
+        ParsedBatch wide;
+        parser.parseBatch(outlier, wide);
+        auto histogram = stats.bucketByTime(wide, 1000);
+        REQUIRE(histogram.counts.size() <= LogStats::MAX_TIME_BUCKETS);
+        REQUIRE(histogram.bucketMs > 1000);
+        REQUIRE(histogram.bucketMs % 1000 == 0);
+        REQUIRE(histogram.startMs == 0);
+        REQUIRE(histogram.counts.front() == 1);
+        REQUIRE(histogram.counts.back() == 1);
+    }
+}
+
+TEST_CASE("LogStats 표본 통계 환산 테스트", "[LogStats]") {
+    LogStats stats;
+    
+    // 블록마다 10 라인, ERROR 비율이 블록별로 다름
+    std::vector<BlockCounts> blocks(4);
+    std::size_t errors[] = {1, 3, 2, 2};
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        blocks[i].lines = 10;
+        blocks[i].levelCounts[LogLevel::ERROR] = errors[i];
+        blocks[i].levelCounts[LogLevel::INFO] = 10 - errors[i];
+    }
+    
+    SECTION("읽은 바이트 비율로 전체를 환산") {
+        auto statistics = stats.calculateSampledStats(blocks, 1000, 40, "/test/log.txt", 10000);
+        REQUIRE(statistics.totalLines == 400);
+        REQUIRE(statistics.levelCounts[LogLevel::ERROR] == 80);
+        REQUIRE(statistics.levelCounts[LogLevel::INFO] == 320);
+        REQUIRE(statistics.sampling.has_value());
+        REQUIRE(statistics.sampling->blockCount == 4);
+        REQUIRE(statistics.sampling->sampledLines == 40);
+        
+        // 블록 간 분산: 잔차 -1,1,0,0 -> 2/(3*4*100) * (1 - 4/40), 95% 반폭(%p)
+        double margin = statistics.sampling->marginOfError[LogLevel::ERROR];
+        REQUIRE(margin > 7.5);
+        REQUIRE(margin < 7.6);
+        
+        std::string json = stats.statsToJson(statistics);
+        REQUIRE(json.find("\"sampling\"") != std::string::npos);
+        REQUIRE(json.find("\"sampledLines\": 40") != std::string::npos);
+        REQUIRE(json.find("\"marginOfError\"") != std::string::npos);
+    }
+    
+    SECTION("모든 블록을 읽으면 오차 없음") {
+        auto statistics = stats.calculateSampledStats(blocks, 1000, 4, "/test/log.txt", 1000);
+        REQUIRE(statistics.totalLines == 40);
+        REQUIRE(statistics.sampling->marginOfError[LogLevel::ERROR] == 0.0);
+    }
+    
+    SECTION("출력에 추정값과 신뢰구간 표시") {
+        auto statistics = stats.calculateSampledStats(blocks, 1000, 40, "/test/log.txt", 10000);
+        std::ostringstream buffer;
+        std::streambuf* orig = std::cout.rdbuf(buffer.rdbuf());
+        stats.printStats(statistics);
+        std::cout.rdbuf(orig);
+        REQUIRE(buffer.str().find("~80") != std::string::npos);
+        REQUIRE(buffer.str().find("%p") != std::string::npos);
+    }
+    
+    SECTION("표본에서 조건에 맞는 라인이 없음") {
+        // --level 로 걸렀을 때처럼 블록마다 해당 레벨 0개
+        std::vector<BlockCounts> empty(3);
+        for (auto& block : empty) {
+            block.levelCounts[LogLevel::ERROR] = 0;
+        }
+        auto statistics = stats.calculateSampledStats(empty, 1000, 40, "/test/log.txt", 10000);
+        REQUIRE(statistics.totalLines == 0);
+        REQUIRE(statistics.levelCounts.empty());
+        REQUIRE(statistics.sampling->sampledLines == 0);
+        
+        std::string json = stats.statsToJson(statistics);
+        REQUIRE(json.find("nan") == std::string::npos);
+        REQUIRE(json.find("\"ERROR\": 0.00") != std::string::npos);
+        
+        std::ostringstream buffer;
+        std::streambuf* orig = std::cout.rdbuf(buffer.rdbuf());
+        stats.printStats(statistics);
+        std::cout.rdbuf(orig);
+        REQUIRE(buffer.str().find("조건에 맞는 라인이 없습니다") != std::string::npos);
+    }
+}
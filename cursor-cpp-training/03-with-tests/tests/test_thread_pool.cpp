@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../ThreadPool.hpp"
+#include <atomic>
+#include <vector>
+
+using namespace LogAnalyzer;
+
+TEST_CASE("ThreadPool 작업 분배", "[ThreadPool]") {
+    SECTION("모든 작업을 한 번씩 실행") {
+        ThreadPool pool(4);
+        REQUIRE(pool.size() == 4);
+        
+        std::vector<std::atomic<int>> runs(1000);
+        pool.run(runs.size(), [&runs](std::size_t i) { runs[i]++; });
+        std::size_t wrong = 0;
+        for (const auto& count : runs) {
+            wrong += count != 1;
+        }
+        REQUIRE(wrong == 0);
+    }
+    
+    SECTION("같은 풀을 여러 번 재사용") {
+        ThreadPool pool(3);
+        std::atomic<std::size_t> sum{0};
+        for (int round = 0; round < 50; ++round) {
+            pool.run(10, [&sum](std::size_t i) { sum += i; });
+        }
+        REQUIRE(sum == 50 * 45);
+    }
+    
+    SECTION("작업 안에서 다시 run 을 불러도 끝남") {
+        ThreadPool pool(2);
+        std::atomic<int> inner{0};
+        pool.run(4, [&](std::size_t) {
+            pool.run(8, [&inner](std::size_t) { inner++; });
+        });
+        REQUIRE(inner == 32);
+    }
+    
+    SECTION("스레드 하나면 호출 스레드가 모두 처리") {
+        ThreadPool pool(1);
+        REQUIRE(pool.size() == 1);
+        std::vector<int> order;
+        pool.run(5, [&order](std::size_t i) { order.push_back(static_cast<int>(i)); });
+        REQUIRE(order == std::vector<int>{0, 1, 2, 3, 4});
+    }
+    
+    SECTION("작업이 없으면 바로 반환") {
+        ThreadPool pool(2);
+        pool.run(0, [](std::size_t) { FAIL("호출되면 안 됨"); });
+    }
+    
+    SECTION("공용 풀은 처음 요청한 크기로 한 번만 생성") {
+        // 다른 테스트가 먼저 만들었을 수 있으므로 크기는 처음 만든 값이 유지되는지만 확인
+        ThreadPool& pool = ThreadPool::shared(3);
+        REQUIRE(&ThreadPool::shared(pool.size() + 2) == &pool);
+        REQUIRE(ThreadPool::shared().size() == pool.size());
+        std::atomic<std::size_t> sum{0};
+        pool.run(10, [&sum](std::size_t i) { sum += i; });
+        REQUIRE(sum == 45);
+    }
+}